@@ -0,0 +1,181 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "Benchmark.h"
+
+#include "engine/EngineClock.h"
+#include "engine/FileUtils.h"
+#include "engine/parsers/CsvReader.h"
+#include "engine/parsers/CsvWriter.h"
+#include "engine/parsers/JsonParser.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <tuple>
+#include <unordered_map>
+
+namespace AuxEngine
+{
+    void BenchmarkRunner::Add(const std::string& name, size_t bytesPerOp, BenchmarkBody body)
+    {
+        benchmarks_.push_back(Benchmark(name, bytesPerOp, std::move(body)));
+    }
+
+    std::vector<BenchmarkResult> BenchmarkRunner::Run(const BenchmarkOptions& options) const
+    {
+        std::vector<BenchmarkResult> results;
+        const int repetitions = std::max(options.repetitions, 1);
+
+        std::cout << std::format("{:<36}{:>14}{:>14}{:>14}{:>14}{:>14}\n", "Benchmark", "Iterations", "ns/op", "min", "max", "MB/s");
+        for (const Benchmark& benchmark : benchmarks_)
+        {
+            if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            const uint64_t iterations = CalibrateIterations(benchmark, options.minRunSeconds);
+            for (int i = 0; i < options.warmupRuns; ++i)
+            {
+                TimeRun(benchmark, iterations);
+            }
+
+            std::vector<double> samples;
+            samples.reserve(repetitions);
+            for (int i = 0; i < repetitions; ++i)
+            {
+                samples.push_back(static_cast<double>(TimeRun(benchmark, iterations)) / static_cast<double>(iterations));
+            }
+            std::sort(samples.begin(), samples.end());
+
+            BenchmarkResult result;
+            result.name = benchmark.name;
+            result.iterations = iterations;
+            result.nsPerOp = samples[samples.size() / 2];
+            result.minNsPerOp = samples.front();
+            result.maxNsPerOp = samples.back();
+            if (benchmark.bytesPerOp > 0 && result.nsPerOp > 0.0)
+            {
+                result.bytesPerSecond = static_cast<double>(benchmark.bytesPerOp) * SECONDS_TO_NANOSECONDS / result.nsPerOp;
+            }
+
+            std::cout << std::format("{:<36}{:>14}{:>14.1f}{:>14.1f}{:>14.1f}{:>14.1f}\n", result.name, result.iterations,
+                result.nsPerOp, result.minNsPerOp, result.maxNsPerOp, result.bytesPerSecond / (1024.0 * 1024.0));
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    bool BenchmarkRunner::WriteJson(const std::vector<BenchmarkResult>& results, const std::string& filePath)
+    {
+        json benchmarks = json::array();
+        for (const BenchmarkResult& result : results)
+        {
+            benchmarks.push_back({
+                { "name", result.name },
+                { "iterations", result.iterations },
+                { "nsPerOp", result.nsPerOp },
+                { "minNsPerOp", result.minNsPerOp },
+                { "maxNsPerOp", result.maxNsPerOp },
+                { "bytesPerSecond", result.bytesPerSecond } });
+        }
+
+        std::ofstream file(filePath, std::ios::out | std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "Unable to open file: " << filePath << '\n';
+            return false;
+        }
+        file << json({ { "benchmarks", benchmarks } }).dump(4) << '\n';
+        return static_cast<bool>(file);
+    }
+
+    bool BenchmarkRunner::WriteCsv(const std::vector<BenchmarkResult>& results, const std::string& filePath)
+    {
+        FileUtils::DeleteFileAtPath(filePath);
+        if (!FileUtils::CreateCsvFile(filePath, { "Name", "Iterations", "NsPerOp", "MinNsPerOp", "MaxNsPerOp", "BytesPerSecond" }))
+        {
+            return false;
+        }
+
+        std::ofstream file(filePath, std::ios::app);
+        if (!file.is_open())
+        {
+            std::cerr << "Unable to open file: " << filePath << '\n';
+            return false;
+        }
+
+        auto writer = CsvWriter<std::ofstream, true>::FromCsv(file);
+        for (const BenchmarkResult& result : results)
+        {
+            writer << std::make_tuple(result.name, result.iterations, result.nsPerOp, result.minNsPerOp, result.maxNsPerOp, result.bytesPerSecond);
+        }
+        return true;
+    }
+
+    bool BenchmarkRunner::CompareBaseline(const std::vector<BenchmarkResult>& results, const std::string& baselineFilePath, double thresholdPercent)
+    {
+        if (!FileUtils::DoesFileExist(baselineFilePath))
+        {
+            std::cerr << "Unable to open baseline: " << baselineFilePath << '\n';
+            return false;
+        }
+
+        std::unordered_map<std::string, double> baseline;
+        CsvReader reader(baselineFilePath);
+        for (CsvRow& row : reader)
+        {
+            baseline[row["Name"].get<std::string>()] = row["NsPerOp"].get<double>();
+        }
+
+        bool bIsWithinThreshold = true;
+        std::cout << std::format("\n{:<36}{:>14}{:>14}{:>10}\n", "Benchmark", "Baseline", "Current", "Change");
+        for (const BenchmarkResult& result : results)
+        {
+            const auto it = baseline.find(result.name);
+            if (it == baseline.end() || it->second <= 0.0)
+            {
+                std::cout << std::format("{:<36}{:>14}{:>14.1f}{:>10}\n", result.name, "-", result.nsPerOp, "new");
+                continue;
+            }
+
+            // Positive is slower.
+            const double changePercent = (result.nsPerOp - it->second) / it->second * 100.0;
+            const bool bIsRegression = changePercent > thresholdPercent;
+            bIsWithinThreshold = bIsWithinThreshold && !bIsRegression;
+
+            std::cout << std::format("{:<36}{:>14.1f}{:>14.1f}{:>+9.1f}%{}\n", result.name, it->second, result.nsPerOp, changePercent,
+                bIsRegression ? "  REGRESSION" : "");
+        }
+        return bIsWithinThreshold;
+    }
+
+    uint64_t BenchmarkRunner::CalibrateIterations(const Benchmark& benchmark, double minRunSeconds)
+    {
+        const uint64_t targetTicks = static_cast<uint64_t>(std::max(minRunSeconds, 0.001) * SECONDS_TO_NANOSECONDS);
+
+        // Grow until a run is long enough for the clock to be meaningful, then scale to the target.
+        uint64_t iterations = 1;
+        uint64_t ticks = TimeRun(benchmark, iterations);
+        while (ticks < targetTicks / 10 && iterations < (1ull << 40))
+        {
+            iterations *= 10;
+            ticks = TimeRun(benchmark, iterations);
+        }
+
+        if (ticks >= targetTicks)
+        {
+            return iterations;
+        }
+        return std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(static_cast<double>(iterations) * targetTicks / std::max<uint64_t>(ticks, 1))));
+    }
+
+    uint64_t BenchmarkRunner::TimeRun(const Benchmark& benchmark, uint64_t iterations)
+    {
+        const uint64_t start = EngineClock::GetCurrentTimeInNanoSeconds();
+        benchmark.body(iterations);
+        return EngineClock::GetCurrentTimeInNanoSeconds() - start;
+    }
+}
@@ -0,0 +1,79 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_BENCHMARK_H
+#define AUX_BENCHMARK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace AuxEngine
+{
+    // Results fed into this are observable, so the compiler cannot drop the work that produced them.
+    inline volatile uint64_t benchmarkSink = 0;
+    inline void Consume(uint64_t value) { benchmarkSink = benchmarkSink + value; }
+
+    struct BenchmarkOptions
+    {
+        int warmupRuns = 1;
+        int repetitions = 5;
+        double minRunSeconds = 0.05;    // Each repetition runs enough iterations to last at least this long.
+        std::string filter;             // Only benchmarks whose name contains this run.
+    };
+
+    struct BenchmarkResult
+    {
+        std::string name;
+        uint64_t iterations = 0;        // Per repetition.
+        double nsPerOp = 0.0;           // Median of the repetitions.
+        double minNsPerOp = 0.0;
+        double maxNsPerOp = 0.0;
+        double bytesPerSecond = 0.0;    // 0 when the benchmark does not process a byte count.
+    };
+
+    /*
+    * Minimal benchmark harness. Each benchmark body runs its operation a given number of times,
+    * the runner calibrates that count, warms up, then reports the median time per operation over the repetitions.
+    */
+    class BenchmarkRunner
+    {
+    public:
+        using BenchmarkBody = std::function<void(uint64_t iterations)>;
+
+        BenchmarkRunner(const BenchmarkRunner&) = delete;
+        BenchmarkRunner(BenchmarkRunner&&) = delete;
+        BenchmarkRunner& operator=(const BenchmarkRunner&) = delete;
+        BenchmarkRunner& operator=(BenchmarkRunner&&) = delete;
+
+        BenchmarkRunner() = default;
+        ~BenchmarkRunner() = default;
+
+        void Add(const std::string& name, size_t bytesPerOp, BenchmarkBody body);
+
+        std::vector<BenchmarkResult> Run(const BenchmarkOptions& options) const;
+
+        static bool WriteJson(const std::vector<BenchmarkResult>& results, const std::string& filePath);
+        static bool WriteCsv(const std::vector<BenchmarkResult>& results, const std::string& filePath);
+
+        // Prints each result against the same benchmark in a CSV written by WriteCsv.
+        // Returns false if the baseline can not be read or any benchmark is slower by more than thresholdPercent.
+        static bool CompareBaseline(const std::vector<BenchmarkResult>& results, const std::string& baselineFilePath, double thresholdPercent);
+
+    private:
+        struct Benchmark
+        {
+            std::string name;
+            size_t bytesPerOp = 0;
+            BenchmarkBody body;
+        };
+
+        std::vector<Benchmark> benchmarks_;
+
+        static uint64_t CalibrateIterations(const Benchmark& benchmark, double minRunSeconds);
+        static uint64_t TimeRun(const Benchmark& benchmark, uint64_t iterations);
+    };
+}
+
+#endif // !AUX_BENCHMARK_H
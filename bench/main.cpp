@@ -0,0 +1,219 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "Benchmark.h"
+
+#include "engine/Date.h"
+#include "engine/DebugLog.h"
+#include "engine/FileUtils.h"
+#include "engine/Hash.h"
+#include "engine/devices/null/NullInputHandler.h"
+#include "engine/parsers/CsvReader.h"
+#include "engine/parsers/IniParser.h"
+#include "engine/parsers/JsonParser.h"
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace AuxEngine;
+
+namespace
+{
+    size_t WriteTextFile(const std::string& filePath, const std::string& text)
+    {
+        std::ofstream file(filePath, std::ios::out | std::ios::trunc | std::ios::binary);
+        file << text;
+        return text.size();
+    }
+
+    // Accepts --name=value, returns false if the argument is a different option.
+    bool ReadOption(const std::string& arg, const std::string& name, std::string& outValue)
+    {
+        const std::string prefix = "--" + name + "=";
+        if (arg.rfind(prefix, 0) != 0)
+        {
+            return false;
+        }
+        outValue = arg.substr(prefix.size());
+        return true;
+    }
+
+    void AddHashBenchmarks(BenchmarkRunner& runner)
+    {
+        for (const size_t size : { size_t(64), size_t(4096) })
+        {
+            runner.Add(std::format("crc32_runtime/{}B", size), size, [size](uint64_t iterations)
+                {
+                    const std::string data(size, 'a');
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        Consume(crc32_runtime(data.data(), data.size()));
+                    }
+                });
+        }
+    }
+
+    void AddParserBenchmarks(BenchmarkRunner& runner, const std::string& dataDir)
+    {
+        const std::string iniFile = dataDir + "Bench.ini";
+        WriteTextFile(iniFile, "[Engine]\nworkerThreads=4\nheadless=false\n\n[Graphics]\nmaxFPS = 144\nspinThresholdMicroseconds = 1500.5\n\n[Window]\nname=AuxEngineBench\n");
+        runner.Add("IniParser/Getters", 0, [iniFile](uint64_t iterations)
+            {
+                IniParser parser(iniFile);
+                parser.Read();
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    Consume(parser.GetInteger("Graphics", "maxFPS", 0));
+                    Consume(static_cast<uint64_t>(parser.GetFloat("Graphics", "spinThresholdMicroseconds", 0.0f)));
+                    Consume(parser.GetBoolean("Engine", "headless", true));
+                    Consume(parser.GetString("Window", "name").size());
+                }
+            });
+
+        std::string jsonText = "{\"items\":[";
+        for (int i = 0; i < 512; ++i)
+        {
+            jsonText += std::format("{}{{\"id\":{},\"name\":\"item{}\",\"value\":{}.5,\"tags\":[\"a\",\"b\"]}}", i > 0 ? "," : "", i, i, i);
+        }
+        jsonText += "]}";
+        const std::string jsonFile = dataDir + "Bench.json";
+        const size_t jsonBytes = WriteTextFile(jsonFile, jsonText);
+        runner.Add("JsonParser/ParseFromFile", jsonBytes, [jsonFile](uint64_t iterations)
+            {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    JsonParser parser;
+                    Consume(parser.ParseFromFile(jsonFile) && parser.Contains("items"));
+                }
+            });
+
+        std::string csvText = "Id,Name,Value,Date\n";
+        for (int i = 0; i < 1000; ++i)
+        {
+            csvText += std::format("{},row{},{}.25,2025-01-{:02}\n", i, i, i, i % 28 + 1);
+        }
+        const std::string csvFile = dataDir + "Bench.csv";
+        const size_t csvBytes = WriteTextFile(csvFile, csvText);
+        runner.Add("CsvReader/Iterate", csvBytes, [csvFile](uint64_t iterations)
+            {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    CsvReader reader(csvFile);
+                    for (CsvRow& row : reader)
+                    {
+                        Consume(row.size());
+                    }
+                }
+            });
+
+        runner.Add("Date/from_string", 0, [](uint64_t iterations)
+            {
+                const std::string dateString = "2025-06-14";
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    Consume(Date::from_string(dateString).day());
+                }
+            });
+    }
+
+    void AddLogBenchmarks(BenchmarkRunner& runner)
+    {
+        // Logs into the file opened by DEBUG_INIT in main.
+        runner.Add("DebugLog/OutputFile", 0, [](uint64_t iterations)
+            {
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    OUTPUT_FILE_LOG(LOG::INFO, "Benchmark message {}", i);
+                }
+            });
+    }
+
+    void AddInputBenchmarks(BenchmarkRunner& runner)
+    {
+        // One press or release per frame, each one dispatched to a bound callback.
+        runner.Add("InputHandler/Dispatch", 0, [](uint64_t iterations)
+            {
+                NullInputHandler inputHandler;
+                inputHandler.Initialize(nullptr);
+
+                uint64_t callbackCount = 0;
+                inputHandler.BindKey(Key::Space, InputAction::Pressed, [&callbackCount](int button, int action) { ++callbackCount; });
+                inputHandler.BindKey(Key::Space, InputAction::Released, [&callbackCount](int button, int action) { ++callbackCount; });
+
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    inputHandler.SetKey(Key::Space, (i & 1) == 0);
+                    inputHandler.Update(0.0f);
+                }
+                Consume(callbackCount);
+            });
+    }
+}
+
+/*
+* AuxEngineBench [--filter=name] [--repetitions=N] [--warmup=N] [--min-time=seconds]
+*                [--json=file] [--csv=file] [--baseline=file.csv] [--threshold=percent]
+* Exits with 1 when a benchmark is slower than the baseline by more than the threshold.
+*/
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+    std::string jsonFile;
+    std::string csvFile;
+    std::string baselineFile;
+    double thresholdPercent = 10.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        std::string value;
+        if (ReadOption(arg, "filter", value))               { options.filter = value; }
+        else if (ReadOption(arg, "repetitions", value))     { options.repetitions = std::stoi(value); }
+        else if (ReadOption(arg, "warmup", value))          { options.warmupRuns = std::stoi(value); }
+        else if (ReadOption(arg, "min-time", value))        { options.minRunSeconds = std::stod(value); }
+        else if (ReadOption(arg, "json", value))            { jsonFile = value; }
+        else if (ReadOption(arg, "csv", value))             { csvFile = value; }
+        else if (ReadOption(arg, "baseline", value))        { baselineFile = value; }
+        else if (ReadOption(arg, "threshold", value))       { thresholdPercent = std::stod(value); }
+        else
+        {
+            std::cerr << "Unknown argument: " << arg << '\n';
+            return 2;
+        }
+    }
+
+    const std::string dataDir = (std::filesystem::temp_directory_path() / "AuxEngineBench").string() + "/";
+    if (!FileUtils::DoesFileExist(dataDir))
+    {
+        FileUtils::CreateDirectories(dataDir);
+    }
+    DEBUG_INIT(dataDir, "AuxEngineBench");
+
+    BenchmarkRunner runner;
+    AddHashBenchmarks(runner);
+    AddParserBenchmarks(runner, dataDir);
+    AddLogBenchmarks(runner);
+    AddInputBenchmarks(runner);
+
+    const std::vector<BenchmarkResult> results = runner.Run(options);
+
+    if (!jsonFile.empty() && !BenchmarkRunner::WriteJson(results, jsonFile))
+    {
+        return 2;
+    }
+
+    if (!csvFile.empty() && !BenchmarkRunner::WriteCsv(results, csvFile))
+    {
+        return 2;
+    }
+
+    if (!baselineFile.empty() && !BenchmarkRunner::CompareBaseline(results, baselineFile, thresholdPercent))
+    {
+        return 1;
+    }
+
+    return 0;
+}
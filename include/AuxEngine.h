@@ -5,15 +5,32 @@
 
 #include "../src/engine/TypeFixMacros.h"
 
+#include "../src/engine/AllocationTracker.h"
 #include "../src/engine/App.h"
 #include "../src/engine/Date.h"
 #include "../src/engine/DebugLog.h"
+#include "../src/engine/DeferredWorkQueue.h"
 #include "../src/engine/Engine.h"
 #include "../src/engine/EngineClock.h"
 #include "../src/engine/EnumIterator.h"
 #include "../src/engine/FileUtils.h"
+#include "../src/engine/FrameArena.h"
+#include "../src/engine/FramePacer.h"
+#include "../src/engine/FrameStats.h"
 #include "../src/engine/Hash.h"
+#include "../src/engine/HitchWatchdog.h"
 #include "../src/engine/InputHandler.h"
+#include "../src/engine/Profiler.h"
+#include "../src/engine/ServiceRegistry.h"
+#include "../src/engine/SpscQueue.h"
+#include "../src/engine/SystemScheduler.h"
+#include "../src/engine/TimerService.h"
+#include "../src/engine/coroutines/Coroutine.h"
+#include "../src/engine/devices/null/NullInputHandler.h"
+#include "../src/engine/events/EngineEvents.h"
+#include "../src/engine/events/EventBus.h"
+#include "../src/engine/jobs/JobSystem.h"
+#include "../src/engine/jobs/TaskGraph.h"
 #include "../src/engine/parsers/CsvReader.h"
 #include "../src/engine/parsers/CsvWriter.h"
 #include "../src/engine/parsers/IniParser.h"
@@ -0,0 +1,156 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/AllocationTracker.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace AuxEngine
+{
+    namespace
+    {
+        struct TagCounters
+        {
+            std::atomic<uint64_t> allocations{ 0 };
+            std::atomic<int64_t> bytesLive{ 0 };
+            std::atomic<int64_t> peakBytes{ 0 };
+            std::atomic<uint64_t> frameAllocations{ 0 };
+            uint64_t frameStartAllocations = 0;     // Main thread only.
+        };
+
+        // Constant initialized, so allocations made by other static initializers are already counted.
+        std::array<TagCounters, static_cast<size_t>(AllocationTag::MAX)> g_tagCounters;
+
+        thread_local AllocationTag tl_allocationTag = AllocationTag::Untagged;
+    }
+
+    void AllocationTracker::BeginFrame()
+    {
+        for (TagCounters& counters : g_tagCounters)
+        {
+            const uint64_t allocations = counters.allocations.load(std::memory_order_relaxed);
+            counters.frameAllocations.store(allocations - counters.frameStartAllocations, std::memory_order_relaxed);
+            counters.frameStartAllocations = allocations;
+        }
+    }
+
+    AllocationStats AllocationTracker::GetStats(AllocationTag tag)
+    {
+        const TagCounters& counters = g_tagCounters[static_cast<size_t>(tag)];
+
+        AllocationStats stats;
+        stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+        stats.frameAllocations = counters.frameAllocations.load(std::memory_order_relaxed);
+        stats.bytesLive = counters.bytesLive.load(std::memory_order_relaxed);
+        stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    AllocationTag AllocationTracker::GetCurrentTag()
+    {
+        return tl_allocationTag;
+    }
+
+    void AllocationTracker::SetCurrentTag(AllocationTag tag)
+    {
+        tl_allocationTag = tag;
+    }
+
+#if defined(AUX_ALLOCATION_TRACKING_ENABLED)
+    namespace
+    {
+        // Sits directly in front of every tracked block, so a free can find its size and tag.
+        struct alignas(16) AllocationHeader
+        {
+            void* base = nullptr;
+            size_t size = 0;
+            AllocationTag tag = AllocationTag::Untagged;
+        };
+
+        void* TrackedAllocate(size_t size, size_t alignment)
+        {
+            alignment = std::max(alignment, alignof(AllocationHeader));
+
+            void* base = std::malloc(sizeof(AllocationHeader) + alignment - 1 + std::max<size_t>(size, 1));
+            if (!base)
+            {
+                return nullptr;
+            }
+
+            const uintptr_t userAddress = (reinterpret_cast<uintptr_t>(base) + sizeof(AllocationHeader) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+            AllocationHeader* header = reinterpret_cast<AllocationHeader*>(userAddress) - 1;
+            header->base = base;
+            header->size = size;
+            header->tag = tl_allocationTag;
+
+            TagCounters& counters = g_tagCounters[static_cast<size_t>(header->tag)];
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            const int64_t bytesLive = counters.bytesLive.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+
+            int64_t peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+            while (bytesLive > peakBytes && !counters.peakBytes.compare_exchange_weak(peakBytes, bytesLive, std::memory_order_relaxed))
+            {
+            }
+
+            return reinterpret_cast<void*>(userAddress);
+        }
+
+        void TrackedFree(void* ptr)
+        {
+            if (!ptr)
+            {
+                return;
+            }
+
+            AllocationHeader* header = static_cast<AllocationHeader*>(ptr) - 1;
+            g_tagCounters[static_cast<size_t>(header->tag)].bytesLive.fetch_sub(static_cast<int64_t>(header->size), std::memory_order_relaxed);
+            std::free(header->base);
+        }
+
+        void* TrackedAllocateOrThrow(size_t size, size_t alignment)
+        {
+            while (true)
+            {
+                if (void* ptr = TrackedAllocate(size, alignment))
+                {
+                    return ptr;
+                }
+
+                std::new_handler handler = std::get_new_handler();
+                if (!handler)
+                {
+                    throw std::bad_alloc();
+                }
+                handler();
+            }
+        }
+    }
+#endif
+}
+
+#if defined(AUX_ALLOCATION_TRACKING_ENABLED)
+void* operator new(size_t size) { return AuxEngine::TrackedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return AuxEngine::TrackedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return AuxEngine::TrackedAllocate(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return AuxEngine::TrackedAllocate(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t alignment) { return AuxEngine::TrackedAllocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return AuxEngine::TrackedAllocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AuxEngine::TrackedAllocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AuxEngine::TrackedAllocate(size, static_cast<size_t>(alignment)); }
+
+void operator delete(void* ptr) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { AuxEngine::TrackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { AuxEngine::TrackedFree(ptr); }
+#endif
@@ -0,0 +1,113 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_ALLOCATIONTRACKER_H
+#define AUX_ALLOCATIONTRACKER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#define AUX_ALLOCATION_CONCAT_INNER(a, b) a##b
+#define AUX_ALLOCATION_CONCAT(a, b) AUX_ALLOCATION_CONCAT_INNER(a, b)
+
+#if defined(AUX_ALLOCATION_TRACKING_ENABLED)
+/* Attributes heap allocations made by the calling thread, until the end of the enclosing scope, to the given AllocationTag. */
+#define AUX_ALLOCATION_SCOPE(tag) AuxEngine::AllocationScope AUX_ALLOCATION_CONCAT(auxAllocationScope_, __LINE__)(tag)
+#else
+#define AUX_ALLOCATION_SCOPE(tag) ((void)0)
+#endif
+
+namespace AuxEngine
+{
+    enum class AllocationTag : uint8_t
+    {
+        Untagged = 0,
+        Engine = 1,
+        Log = 2,
+        Input = 3,
+        Parsers = 4,
+        Jobs = 5,
+        App = 6,
+        MAX = 7
+    };
+
+    constexpr static const char* ToString(AllocationTag tag)
+    {
+        switch (tag)
+        {
+        case AllocationTag::Untagged:   return "Untagged";
+        case AllocationTag::Engine:     return "Engine";
+        case AllocationTag::Log:        return "Log";
+        case AllocationTag::Input:      return "Input";
+        case AllocationTag::Parsers:    return "Parsers";
+        case AllocationTag::Jobs:       return "Jobs";
+        case AllocationTag::App:        return "App";
+        default:                        return "Unknown";
+        }
+    }
+
+    struct AllocationStats
+    {
+        uint64_t allocations = 0;       // Since startup.
+        uint64_t frameAllocations = 0;  // During the last completed frame.
+        int64_t bytesLive = 0;
+        int64_t peakBytes = 0;
+    };
+
+    /*
+    * Global operator new/delete replacement that counts allocations per subsystem.
+    * Allocations are charged to the tag of the innermost AllocationScope on the allocating thread and
+    * credited back to that same tag when freed, wherever the free happens.
+    * Only compiled in with AUX_ALLOCATION_TRACKING_ENABLED, otherwise every stat reads zero.
+    */
+    class AllocationTracker
+    {
+    public:
+        AllocationTracker() = delete;	// Static class, no constructor needed
+        AllocationTracker(const AllocationTracker&) = delete;
+        AllocationTracker& operator=(const AllocationTracker&) = delete;
+        AllocationTracker(AllocationTracker&&) = delete;
+        AllocationTracker& operator=(AllocationTracker&&) = delete;
+
+        static constexpr bool IsEnabled()
+        {
+#if defined(AUX_ALLOCATION_TRACKING_ENABLED)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        // Closes the previous frame's allocation counts. Main thread, once per frame.
+        static void BeginFrame();
+
+        static AllocationStats GetStats(AllocationTag tag);
+
+        static AllocationTag GetCurrentTag();
+        static void SetCurrentTag(AllocationTag tag);
+    };
+
+    class AllocationScope
+    {
+    public:
+        AllocationScope(const AllocationScope&) = delete;
+        AllocationScope& operator=(const AllocationScope&) = delete;
+        AllocationScope(AllocationScope&&) = delete;
+        AllocationScope& operator=(AllocationScope&&) = delete;
+
+        explicit AllocationScope(AllocationTag tag) :
+            prevTag_(AllocationTracker::GetCurrentTag())
+        {
+            AllocationTracker::SetCurrentTag(tag);
+        }
+
+        ~AllocationScope()
+        {
+            AllocationTracker::SetCurrentTag(prevTag_);
+        }
+
+    private:
+        AllocationTag prevTag_;
+    };
+}
+
+#endif // !AUX_ALLOCATIONTRACKER_H
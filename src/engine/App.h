@@ -5,6 +5,8 @@
 
 namespace  AuxEngine
 {
+    class SystemScheduler;
+
     // TODO: Add logic to properly handle appliaction Exit and correct handling in Engine for when the application has been exited.
 
     class App
@@ -26,11 +28,36 @@ namespace  AuxEngine
             return OnEnter();
         }
 
+        // Called on a startup thread while the engine starts, when the app is handed to Engine::Start. For loading assets ahead of Enter,
+        // none of the engine's services are up yet.
+        void Preload()
+        {
+            OnPreload();
+        }
+
+        // Called once when the app is loaded, before Enter, to add the app's systems to the engine phases.
+        void RegisterSystems( SystemScheduler& systems )
+        {
+            OnRegisterSystems( systems );
+        }
+
         void Update( const float deltaTime )
         {
             OnUpdate( deltaTime );
         }
 
+        // Called zero or more times per frame with a constant step, when the engine runs with a fixed timestep.
+        void FixedUpdate( const float fixedDeltaTime )
+        {
+            OnFixedUpdate( fixedDeltaTime );
+        }
+
+        // Called once per frame after all fixed steps. Alpha is how far [0, 1) the frame sits between the last and next fixed step.
+        void Render( const float alpha )
+        {
+            OnRender( alpha );
+        }
+
         void Exit()
         {
             OnExit();
@@ -38,7 +65,11 @@ namespace  AuxEngine
 
     private:
         virtual bool OnEnter() { return true; }
+        virtual void OnPreload() {}
+        virtual void OnRegisterSystems( SystemScheduler& systems ) {}
         virtual void OnUpdate( const float deltaTime ) {}
+        virtual void OnFixedUpdate( const float fixedDeltaTime ) {}
+        virtual void OnRender( const float alpha ) {}
         virtual void OnExit() {}
     };
 }
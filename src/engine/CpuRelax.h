@@ -0,0 +1,29 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_CPURELAX_H
+#define AUX_CPURELAX_H
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define AUX_HAS_MM_PAUSE 1
+#else
+#include <thread>
+#endif
+
+namespace AuxEngine
+{
+    /*
+    * Hint to the CPU that we are inside a spin-wait loop.
+    * Lowers power draw and frees pipeline resources for the sibling hyper-thread while spinning.
+    */
+    inline void CpuRelax()
+    {
+#ifdef AUX_HAS_MM_PAUSE
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+}
+
+#endif // !AUX_CPURELAX_H
@@ -3,6 +3,8 @@
 #ifndef AUX_DEBUGLOG_H
 #define AUX_DEBUGLOG_H
 
+#include "engine/AllocationTracker.h"
+
 #include <filesystem>
 #include <format>
 #include <fstream>
@@ -91,6 +93,7 @@ namespace AuxEngine
 			const int line,
 			Args&& ... args)
 		{
+			AUX_ALLOCATION_SCOPE(AllocationTag::Log);
 			std::ofstream outputFile;
 			outputFile.open(outputFilePath, std::ios::app | std::ios::out);
 			if (!outputFile)
@@ -123,6 +126,7 @@ namespace AuxEngine
 			const int line,
 			Args&& ... args)
 		{
+			AUX_ALLOCATION_SCOPE(AllocationTag::Log);
 			/*[05/15/22|21:33:51][INFO]:	FunctionName(00):	Message {}*/
 			std::string output;
 			output.append(BuildTimeStamp());
@@ -0,0 +1,89 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/DeferredWorkQueue.h"
+
+#include "engine/EngineClock.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace AuxEngine
+{
+    void DeferredWorkQueue::Push(WorkItem work)
+    {
+        if (!work)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(work));
+    }
+
+    size_t DeferredWorkQueue::RunUntil(uint64_t deadlineTicks)
+    {
+        // Only what is queued now, an item that queues more work, itself included, cannot keep this call from returning.
+        const size_t pendingCount = GetPendingCount();
+        size_t ranCount = 0;
+        WorkItem work;
+        while (ranCount < pendingCount)
+        {
+            const uint64_t start = EngineClock::GetCurrentTimeInNanoSeconds();
+            if (start >= deadlineTicks)
+            {
+                break;
+            }
+
+            if (deadlineTicks - start <= estimatedCostTicks_)
+            {
+                // The estimate only moves when an item runs, so one slow item would otherwise keep the queue from ever running again.
+                // Halving it on every call that had time left but skipped lets it fit the leftover time again within a few frames.
+                // It stops at what the last item took, so work that is steadily too long for the slack keeps waiting instead of overrunning.
+                if (ranCount == 0)
+                {
+                    estimatedCostTicks_ = std::max(estimatedCostTicks_ / 2, lastCostTicks_);
+                    ++starvedCount_;
+                }
+                break;
+            }
+
+            if (!Pop(work))
+            {
+                break;
+            }
+
+            work();
+            ++ranCount;
+
+            // Weighted towards recent items, so a burst of heavy work quickly shrinks how much we attempt.
+            const uint64_t cost = EngineClock::GetCurrentTimeInNanoSeconds() - start;
+            lastCostTicks_ = cost;
+            estimatedCostTicks_ = estimatedCostTicks_ == 0 ? cost : (estimatedCostTicks_ * 3 + cost) / 4;
+        }
+        return ranCount;
+    }
+
+    size_t DeferredWorkQueue::RunAll()
+    {
+        return RunUntil(std::numeric_limits<uint64_t>::max());
+    }
+
+    size_t DeferredWorkQueue::GetPendingCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
+
+    bool DeferredWorkQueue::Pop(WorkItem& outWork)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty())
+        {
+            return false;
+        }
+
+        outWork = std::move(queue_.front());
+        queue_.pop_front();
+        return true;
+    }
+}
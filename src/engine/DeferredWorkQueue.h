@@ -0,0 +1,60 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_DEFERREDWORKQUEUE_H
+#define AUX_DEFERREDWORKQUEUE_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+namespace AuxEngine
+{
+    /*
+    * Low priority work that does not need to finish within the frame it was queued in.
+    * Any thread may push work, it is only ever run on the thread driving the app, the simulation thread while the engine runs one.
+    * The queue estimates an item's cost from recent runs and stops early rather than run past a deadline.
+    * Every call that skips work it had some time for halves the estimate, so one slow item among fast ones cannot stall the queue,
+    * but never below what the last item took. Items must be sliced to fit the time left over in a frame,
+    * work that steadily takes longer waits for a frame with enough slack, or RunAll, and is counted as starved.
+    */
+    class DeferredWorkQueue
+    {
+    public:
+        using WorkItem = std::function<void()>;
+
+        DeferredWorkQueue() = default;
+        DeferredWorkQueue(const DeferredWorkQueue&) = delete;
+        DeferredWorkQueue(DeferredWorkQueue&&) = delete;
+        DeferredWorkQueue& operator=(const DeferredWorkQueue&) = delete;
+        DeferredWorkQueue& operator=(DeferredWorkQueue&&) = delete;
+        ~DeferredWorkQueue() = default;
+
+        void Push(WorkItem work);
+
+        // Runs queued work in order until the queue is empty or the next item is not expected to finish before the deadline, in EngineClock nanoseconds.
+        // Work pushed while running waits for the next call. Returns the number of items run.
+        size_t RunUntil(uint64_t deadlineTicks);
+        size_t RunAll();
+
+        size_t GetPendingCount() const;
+        bool IsEmpty() const { return GetPendingCount() == 0; }
+
+        // Moving average of how long a single item takes to run, in nanoseconds.
+        uint64_t GetEstimatedCostTicks() const { return estimatedCostTicks_; }
+
+        // Calls to RunUntil that had time left but ran nothing, because the next item was not expected to fit.
+        uint64_t GetStarvedCount() const { return starvedCount_; }
+
+    private:
+        mutable std::mutex mutex_;
+        std::deque<WorkItem> queue_;
+        uint64_t estimatedCostTicks_ = 0;
+        uint64_t lastCostTicks_ = 0;
+        uint64_t starvedCount_ = 0;
+
+        bool Pop(WorkItem& outWork);
+    };
+}
+
+#endif // !AUX_DEFERREDWORKQUEUE_H
@@ -2,15 +2,33 @@
 
 #include "engine/Engine.h"
 
+#include "engine/AllocationTracker.h"
 #include "engine/App.h"
 #include "engine/DebugLog.h"
+#include "engine/DeferredWorkQueue.h"
 #include "engine/EngineClock.h"
 #include "engine/EngineConfig.h"
+#include "engine/FrameArena.h"
+#include "engine/FramePacer.h"
+#include "engine/FrameRecording.h"
+#include "engine/HitchWatchdog.h"
+#include "engine/Profiler.h"
+#include "engine/SystemScheduler.h"
+#include "engine/TimerService.h"
+#include "engine/coroutines/Coroutine.h"
+#include "engine/events/EventBus.h"
 #include "engine/devices/GLFW/GLFWInputHandler.h"
 #include "engine/devices/GLFW/GLFWWindowHandler.h"
+#include "engine/devices/null/NullInputHandler.h"
+#include "engine/devices/null/NullWindowHandler.h"
+#include "engine/jobs/JobSystem.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <fstream>
+#include <future>
+#include <limits>
 #include <string>
 #include <thread>
 
@@ -49,15 +67,111 @@ namespace  AuxEngine
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~   
 )";
 
+    static void LogAllocationStats(LOG logType)
+    {
+        if (!AllocationTracker::IsEnabled())
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < static_cast<size_t>(AllocationTag::MAX); ++i)
+        {
+            const AllocationTag tag = static_cast<AllocationTag>(i);
+            const AllocationStats stats = AllocationTracker::GetStats(tag);
+            if (stats.allocations == 0)
+            {
+                continue;
+            }
+            DEBUG_LOG(logType, "Allocations {} last frame:{} total:{} live:{}KB peak:{}KB",
+                ToString(tag), stats.frameAllocations, stats.allocations, stats.bytesLive / 1024, stats.peakBytes / 1024);
+        }
+    }
+
+    // Writes the wall time of the enclosing scope into one phase of the startup timing.
+    class StartupPhaseTimer
+    {
+    public:
+        StartupPhaseTimer(const StartupPhaseTimer&) = delete;
+        StartupPhaseTimer& operator=(const StartupPhaseTimer&) = delete;
+        StartupPhaseTimer(StartupPhaseTimer&&) = delete;
+        StartupPhaseTimer& operator=(StartupPhaseTimer&&) = delete;
+
+        StartupPhaseTimer(StartupTiming& timing, StartupPhase phase) :
+            timing_(timing),
+            phase_(phase),
+            start_(EngineClock::GetCurrentTimeInNanoSeconds())
+        {}
+
+        ~StartupPhaseTimer()
+        {
+            timing_.phaseTicks[static_cast<size_t>(phase_)] = EngineClock::GetCurrentTimeInNanoSeconds() - start_;
+        }
+
+    private:
+        StartupTiming& timing_;
+        StartupPhase phase_;
+        uint64_t start_;
+    };
+
+    static void LogStartupTiming(const StartupTiming& timing)
+    {
+        std::string phases;
+        for (size_t i = 0; i < static_cast<size_t>(StartupPhase::MAX); ++i)
+        {
+            if (timing.phaseTicks[i] > 0)
+            {
+                phases += std::format(" {}:{:.2f}", ToString(static_cast<StartupPhase>(i)), static_cast<double>(timing.phaseTicks[i]) / MILLISECONDS_TO_NANOSECONDS);
+            }
+        }
+        DEBUG_LOG(LOG::INFO, "Startup took {:.2f}ms, phases in ms:{}", static_cast<double>(timing.totalTicks) / MILLISECONDS_TO_NANOSECONDS, phases);
+    }
+
     Engine::Engine() :
+        services_(),
         mode_(Mode::Standalone),
         isRunning_(false),
         config_(nullptr),
         clock_(std::make_unique<EngineClock>()),
+        framePacer_(std::make_unique<FramePacer>()),
+        frameStats_(std::make_unique<FrameStatsRecorder>(600)),
+        frameTiming_(),
+        statsLogInterval_(0.0),
+        nextStatsLogTime_(0.0),
         windowHandler_(nullptr),
-        inputHandler_(GLFWInputHandler::Get()),
-        app_(std::make_unique<App>())
-    {}
+        glfwInputHandler_(std::make_unique<GLFWInputHandler>()),
+        inputHandler_(glfwInputHandler_.get()),
+        nullInputHandler_(nullptr),
+        jobSystem_(nullptr),
+        frameGraph_(std::make_unique<TaskGraph>()),
+        systems_(std::make_unique<SystemScheduler>()),
+        deferredWork_(std::make_unique<DeferredWorkQueue>()),
+        timers_(std::make_unique<TimerService>()),
+        frameArena_(std::make_unique<FrameArena>(1024 * 1024)),
+        eventBus_(std::make_unique<EventBus>()),
+        coroutines_(std::make_unique<CoroutineScheduler>()),
+        frameRecorder_(nullptr),
+        frameReplayer_(nullptr),
+        watchdog_(std::make_unique<HitchWatchdog>()),
+        traceFile_(),
+        startupTiming_(),
+        frameDeltaTime_(0.0),
+        app_(std::make_unique<App>()),
+        bAdaptivePacing_(false),
+        powerMode_(PowerMode::Active),
+        powerModeFPS_(),
+        idleTimeoutTicks_(0),
+        lastActivityTicks_(0),
+        fixedDeltaTime_(0.0),
+        fixedTimeAccumulator_(0.0),
+        maxFixedStepsPerFrame_(1),
+        simulationDeltaTime_(0.0),
+        simulationPacer_(std::make_unique<FramePacer>()),
+        bIsSimulating_(false),
+        simulationThread_()
+    {
+        RegisterServices();
+        BuildFrameGraph();
+    }
 
     Engine::~Engine()
     {
@@ -67,16 +181,326 @@ namespace  AuxEngine
 		}
     }
 
-    void Engine::Update(const float deltaTime)
+    void Engine::Update(const double deltaTime)
     {
+        watchdog_->BeginFrame();
+        AUX_PROFILE_SCOPE("Engine::Update");
+        AUX_ALLOCATION_SCOPE(AllocationTag::Engine);
+        ServiceRegistry::SetCurrent(&services_);
+        AllocationTracker::BeginFrame();
+
+        // With a simulation thread these move to StepSimulation, this frame only pumps the window and input.
+        if (!IsSimulationThreaded())
+        {
+            // deltaTime is real time, everything downstream of here runs on the scaled Sim channel.
+            frameDeltaTime_ = clock_->AdvanceScaledTime(deltaTime);
+            frameArena_->BeginFrame();
+
+            // Events posted since the last frame, from any thread, are delivered before any of this frame's work.
+            eventBus_->Dispatch();
+        }
+
+        if (frameRecorder_)
+        {
+            frameRecorder_->RecordFrame(deltaTime);
+        }
+        frameGraph_->Execute(jobSystem_.get());
+    }
+
+    void Engine::RegisterServices()
+    {
+        // Same order the services start in, Start registers again once the ones it creates exist.
+        services_.Register<Engine>(this);
+        services_.Register<EngineConfig>(config_.get());
+        services_.Register<EngineClock>(clock_.get());
+        services_.Register<FramePacer>(framePacer_.get());
+        services_.Register<FrameStatsRecorder>(frameStats_.get());
+        services_.Register<FrameArena>(frameArena_.get());
+        services_.Register<EventBus>(eventBus_.get());
+        services_.Register<WindowHandler>(windowHandler_.get());
+        services_.Register<InputHandler>(inputHandler_);
+        services_.Register<JobSystem>(jobSystem_.get());
+        services_.Register<TaskGraph>(frameGraph_.get());
+        services_.Register<SystemScheduler>(systems_.get());
+        services_.Register<DeferredWorkQueue>(deferredWork_.get());
+        services_.Register<TimerService>(timers_.get());
+        services_.Register<CoroutineScheduler>(coroutines_.get());
+    }
+
+    void Engine::BuildFrameGraph()
+    {
+        // GLFW and app callbacks expect the main thread, so only the stats report is free to run on a worker.
+        frameGraph_->AddTask("WindowEvents", [this]() { UpdateWindowEvents(); },
+            {}, { FrameResource::Window }, TaskAffinity::MainThread);
+
+        frameGraph_->AddTask("Input", [this]() { UpdateInput(); },
+            { FrameResource::Window }, { FrameResource::Input }, TaskAffinity::MainThread);
+
+        frameGraph_->AddTask("App", [this]() { if (!IsSimulationThreaded()) { UpdateApp(); } },
+            { FrameResource::Input }, { FrameResource::App }, TaskAffinity::MainThread);
+
+        frameGraph_->AddTask("Stats", [this]() { ReportFrameStats(); },
+            {}, { FrameResource::Stats });
+    }
+
+    void Engine::UpdateWindowEvents()
+    {
+        if (!windowHandler_)
+        {
+            return;
+        }
+
+        watchdog_->SetPhase(FramePhase::Update);
+        const uint64_t start = EngineClock::GetCurrentTimeInNanoSeconds();
         windowHandler_->ProcessEvents();
-        inputHandler_.Update(deltaTime);
-        app_->Update(deltaTime);
+        frameTiming_.phaseTicks[static_cast<size_t>(FramePhase::Update)] = EngineClock::GetCurrentTimeInNanoSeconds() - start;
+    }
+
+    void Engine::UpdateInput()
+    {
+        // The GLFW handler is bound to the window, there is nothing to poll without one. The null handler is fed by the host instead.
+        if (!windowHandler_ && inputHandler_ != nullInputHandler_.get())
+        {
+            return;
+        }
+
+        AUX_ALLOCATION_SCOPE(AllocationTag::Input);
+        watchdog_->SetPhase(FramePhase::Input);
+        const uint64_t start = EngineClock::GetCurrentTimeInNanoSeconds();
+        // The clock channels belong to the simulation thread while it runs, input then steps in real time.
+        const double deltaTime = IsSimulationThreaded() ? clock_->GetDeltaTimeAsDouble() : clock_->GetChannelDeltaTime(ClockChannel::UI);
+        inputHandler_->Update(static_cast<float>(deltaTime));
 
-        if (inputHandler_.IsKeyDown(Key::Escape))
+        if (inputHandler_->IsKeyDown(Key::Escape))
         {
             isRunning_ = false;
         }
+        frameTiming_.phaseTicks[static_cast<size_t>(FramePhase::Input)] = EngineClock::GetCurrentTimeInNanoSeconds() - start;
+    }
+
+    void Engine::UpdateApp()
+    {
+        AUX_PROFILE_SCOPE("Engine::UpdateApp");
+        watchdog_->SetPhase(FramePhase::App);
+        const uint64_t start = EngineClock::GetCurrentTimeInNanoSeconds();
+        StepApp();
+        frameTiming_.phaseTicks[static_cast<size_t>(FramePhase::App)] = EngineClock::GetCurrentTimeInNanoSeconds() - start;
+    }
+
+    void Engine::StepApp()
+    {
+        AUX_ALLOCATION_SCOPE(AllocationTag::App);
+        const float deltaTime = static_cast<float>(frameDeltaTime_);
+
+        // Timers and ready coroutines run before any app code, so this frame's systems see their effects.
+        timers_->Advance(static_cast<uint64_t>(std::max(frameDeltaTime_, 0.0) * SECONDS_TO_NANOSECONDS));
+        coroutines_->Update(jobSystem_.get());
+
+        systems_->RunPhase(SystemPhase::PreUpdate, deltaTime, jobSystem_.get());
+        const float alpha = StepFixedUpdate(frameDeltaTime_);
+        app_->Update(deltaTime);
+        systems_->RunPhase(SystemPhase::Update, deltaTime, jobSystem_.get());
+        systems_->RunPhase(SystemPhase::PostUpdate, deltaTime, jobSystem_.get());
+        app_->Render(alpha);
+        systems_->RunPhase(SystemPhase::Late, deltaTime, jobSystem_.get());
+    }
+
+    float Engine::StepFixedUpdate(const double deltaTime)
+    {
+        if (fixedDeltaTime_ <= 0.0)
+        {
+            return 1.0f;
+        }
+
+        fixedTimeAccumulator_ += deltaTime;
+
+        // A fast-forwarded clock or a step of a paused one legitimately needs more steps per frame, only real hitches should drop time.
+        const double timeScale = std::max(clock_->GetChannelEffectiveScale(ClockChannel::Sim), 1.0);
+        const double stepTime = clock_->IsChannelPaused(ClockChannel::Sim) ? 0.0 : clock_->GetFrameStepTime() * clock_->GetChannelTimeScale(ClockChannel::Sim);
+        const double stepFixedSteps = std::ceil(stepTime / fixedDeltaTime_);
+        const int maxSteps = static_cast<int>(std::min(maxFixedStepsPerFrame_ * std::ceil(timeScale) + stepFixedSteps, static_cast<double>(std::numeric_limits<int>::max())));
+
+        int steps = 0;
+        while (fixedTimeAccumulator_ >= fixedDeltaTime_ && steps < maxSteps)
+        {
+            app_->FixedUpdate(static_cast<float>(fixedDeltaTime_));
+            fixedTimeAccumulator_ -= fixedDeltaTime_;
+            ++steps;
+        }
+
+        // Drop the time we could not catch up on, otherwise one long frame keeps the simulation running behind indefinitely.
+        if (fixedTimeAccumulator_ >= fixedDeltaTime_)
+        {
+            fixedTimeAccumulator_ = std::fmod(fixedTimeAccumulator_, fixedDeltaTime_);
+        }
+
+        return static_cast<float>(fixedTimeAccumulator_ / fixedDeltaTime_);
+    }
+
+    void Engine::StartSimulationThread()
+    {
+        if (simulationDeltaTime_ <= 0.0 || simulationThread_.joinable())
+        {
+            return;
+        }
+
+        // Input keeps being pumped here, the simulation thread applies it and runs the bindings at the start of each step.
+        inputHandler_->SetDeferredDispatch(true);
+        simulationPacer_->Reset();
+        bIsSimulating_.store(true, std::memory_order_release);
+        const uint64_t hitchThresholdTicks = watchdog_->IsRunning() ? GetHitchThresholdTicks(simulationPacer_->GetTargetFPS()) : 0;
+        simulationThread_ = std::thread(&Engine::RunSimulation, this, hitchThresholdTicks);
+        DEBUG_LOG(LOG::INFO, "Simulation thread started at {}Hz.", simulationPacer_->GetTargetFPS());
+    }
+
+    void Engine::StopSimulationThread()
+    {
+        if (!simulationThread_.joinable())
+        {
+            return;
+        }
+
+        bIsSimulating_.store(false, std::memory_order_release);
+        simulationThread_.join();
+        inputHandler_->SetDeferredDispatch(false);
+        DEBUG_LOG(LOG::INFO, "Simulation thread stopped, missed deadlines: {}", simulationPacer_->GetMissedDeadlineCount());
+    }
+
+    void Engine::RunSimulation(const uint64_t hitchThresholdTicks)
+    {
+        AUX_PROFILE_THREAD("Simulation");
+        ServiceRegistry::SetCurrent(&services_);
+
+        // The app steps here, so this thread gets a heartbeat of its own, main thread frames only pump the window and input.
+        if (hitchThresholdTicks > 0)
+        {
+            watchdog_->Watch(WatchedThread::Simulation, hitchThresholdTicks);
+        }
+
+        const uint64_t spinTicks = std::chrono::duration_cast<std::chrono::nanoseconds>(simulationPacer_->GetSpinThreshold()).count();
+        while (bIsSimulating_.load(std::memory_order_acquire))
+        {
+            StepSimulation();
+
+            // Deferred work is app work, so it runs here between steps rather than on the main thread alongside them.
+            const uint64_t stepDeadline = simulationPacer_->GetFrameDeadlineTicks();
+            watchdog_->SetPhase(FramePhase::Idle, WatchedThread::Simulation);
+            deferredWork_->RunUntil(stepDeadline > spinTicks ? stepDeadline - spinTicks : 0);
+            watchdog_->SetPhase(FramePhase::Sleep, WatchedThread::Simulation);
+            simulationPacer_->WaitForNextFrame();
+        }
+
+        watchdog_->Unwatch(WatchedThread::Simulation);
+    }
+
+    uint64_t Engine::GetHitchThresholdTicks(const int targetFPS) const
+    {
+        const uint64_t budgetTicks = targetFPS > 0 ? SECONDS_TO_NANOSECONDS / targetFPS : 0;
+        return std::max<uint64_t>(static_cast<uint64_t>(budgetTicks * std::max(config_->GetHitchBudgetMultiplier(), 1.0f)),
+            static_cast<uint64_t>(std::max(config_->GetMinHitchMilliseconds(), 1)) * MILLISECONDS_TO_NANOSECONDS);
+    }
+
+    void Engine::StepSimulation()
+    {
+        AUX_PROFILE_SCOPE("Engine::StepSimulation");
+        AUX_ALLOCATION_SCOPE(AllocationTag::Engine);
+
+        watchdog_->BeginFrame(WatchedThread::Simulation);
+
+        // Every step advances by the same amount, a step that overruns slows the simulation down rather than making the next one longer.
+        frameDeltaTime_ = clock_->AdvanceScaledTime(simulationDeltaTime_);
+        frameArena_->BeginFrame();
+        eventBus_->Dispatch();
+        watchdog_->SetPhase(FramePhase::Input, WatchedThread::Simulation);
+        inputHandler_->DispatchDeferredInput();
+        watchdog_->SetPhase(FramePhase::App, WatchedThread::Simulation);
+        StepApp();
+    }
+
+    void Engine::RecordFrame(const uint64_t sleepTicks)
+    {
+        frameTiming_.phaseTicks[static_cast<size_t>(FramePhase::Sleep)] = sleepTicks;
+        frameTiming_.frameTicks = EngineClock::GetCurrentTimeInNanoSeconds() - clock_->GetCurrentTicks();
+        frameStats_->Record(frameTiming_);
+
+        // Frame end, every zone of this frame has closed on the main thread.
+        Profiler::Flush();
+    }
+
+    void Engine::RunDeferredWork(const uint64_t deadlineTicks)
+    {
+        AUX_PROFILE_SCOPE("Engine::RunDeferredWork");
+        watchdog_->SetPhase(FramePhase::Idle);
+        const uint64_t start = EngineClock::GetCurrentTimeInNanoSeconds();
+        deferredWork_->RunUntil(deadlineTicks);
+        frameTiming_.phaseTicks[static_cast<size_t>(FramePhase::Idle)] = EngineClock::GetCurrentTimeInNanoSeconds() - start;
+    }
+
+    void Engine::UpdatePowerMode()
+    {
+        if (!bAdaptivePacing_)
+        {
+            return;
+        }
+
+        // Live time, input handled this frame is timestamped after the frame started.
+        const uint64_t now = EngineClock::GetCurrentTimeInNanoSeconds();
+        lastActivityTicks_ = std::min(std::max(lastActivityTicks_, inputHandler_->GetLastInputTimestamp()), now);
+
+        PowerMode powerMode = PowerMode::Active;
+        if (windowHandler_->IsMinimized())
+        {
+            powerMode = PowerMode::Minimized;
+        }
+        else if (!windowHandler_->IsFocused())
+        {
+            powerMode = PowerMode::Unfocused;
+        }
+        else if (idleTimeoutTicks_ > 0 && now - lastActivityTicks_ > idleTimeoutTicks_)
+        {
+            powerMode = PowerMode::Idle;
+        }
+
+        // The idle timeout only counts time spent focused, coming back to the window starts it over.
+        if (powerMode == PowerMode::Minimized || powerMode == PowerMode::Unfocused)
+        {
+            lastActivityTicks_ = now;
+        }
+
+        if (powerModeFPS_[static_cast<size_t>(powerMode)] == 0)
+        {
+            powerMode = PowerMode::Active;
+        }
+
+        if (powerMode != powerMode_)
+        {
+            DEBUG_LOG(LOG::INFO, "Power mode {} -> {}", ToString(powerMode_), ToString(powerMode));
+            if (powerMode == PowerMode::Active)
+            {
+                framePacer_->Reset();
+            }
+            powerMode_ = powerMode;
+        }
+    }
+
+    void Engine::ReportFrameStats()
+    {
+        const double elapsedTime = clock_->GetElapsedTime();
+        if (statsLogInterval_ <= 0.0 || elapsedTime < nextStatsLogTime_)
+        {
+            return;
+        }
+        nextStatsLogTime_ = elapsedTime + statsLogInterval_;
+
+        const FrameStats stats = frameStats_->GetStats();
+        DEBUG_LOG(LOG::TRACE, "Frame ms min:{:.2f} mean:{:.2f} p50:{:.2f} p95:{:.2f} p99:{:.2f} max:{:.2f} over budget:{}/{} ({} total)",
+            stats.minMs, stats.meanMs, stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.maxMs,
+            stats.overBudgetCount, stats.sampleCount, stats.totalOverBudgetCount);
+        DEBUG_LOG(LOG::TRACE, "Frame arena high water mark:{}KB of {}KB, frames overflowed:{}",
+            frameArena_->GetHighWaterMark() / 1024, frameArena_->GetCapacity() / 1024, frameArena_->GetOverflowFrameCount());
+        LogAllocationStats(LOG::TRACE);
+
+        frameStats_->AppendCsv(stats, elapsedTime);
     }
 
     bool Engine::IsStandalone() const
@@ -84,42 +508,249 @@ namespace  AuxEngine
         return mode_ == Mode::Standalone;
     }
 
-    void Engine::Start(Mode mode, const char* outputDir)
+    void Engine::Start(Mode mode, const char* outputDir, App* app)
     {
-        DEBUG_INIT(outputDir, AsciiLogoRaw);
-        DEBUG_LOG(LOG::INFO, "Waking up...");
+        const uint64_t startupBegin = EngineClock::GetCurrentTimeInNanoSeconds();
+        startupTiming_ = StartupTiming();
+        std::unique_ptr<App> startupApp(app);
 
         mode_ = mode;
         isRunning_ = false;
 
-        if (mode_ == Mode::Standalone)
+        // Read up front, the settings tell whether the window will be needed. The config task takes them over rather than parsing the file again.
+        IniParser iniSettings("");
+        if (mode_ == Mode::Standalone || mode_ == Mode::Headless)
         {
-            DEBUG_LOG(LOG::INFO, "Standalone mode activated. Please standby.");
+            iniSettings = EngineConfig::ReadIniFile(outputDir);
+        }
+        const bool bIsPlatformNeeded = mode_ == Mode::Standalone && !EngineConfig::IsHeadlessRequested(iniSettings);
 
-            config_ = std::make_unique<EngineConfig>(outputDir);
+        // Log setup, config parse and app preloading only touch files, so they run on startup threads while the platform layer comes up here.
+        // Nothing may log before the log file exists, so preloading only starts once it does. Both futures join on every return.
+        std::future<void> preloadTask;
+        std::future<void> configTask = std::async(std::launch::async, [this, outputDir, &startupApp, &preloadTask, &iniSettings]()
+            {
+                {
+                    StartupPhaseTimer timer(startupTiming_, StartupPhase::Log);
+                    DEBUG_INIT(outputDir, AsciiLogoRaw);
+                    DEBUG_LOG(LOG::INFO, "Waking up...");
+                }
 
-            clock_->SetFPS(config_->GetMaxFPS());
+                if (startupApp)
+                {
+                    preloadTask = std::async(std::launch::async, [this, &startupApp]()
+                        {
+                            StartupPhaseTimer timer(startupTiming_, StartupPhase::Preload);
+                            startupApp->Preload();
+                        });
+                }
 
+                if (mode_ == Mode::Standalone || mode_ == Mode::Headless)
+                {
+                    StartupPhaseTimer timer(startupTiming_, StartupPhase::Config);
+                    config_ = std::make_unique<EngineConfig>(outputDir, std::move(iniSettings));
+                }
+            });
+
+        // Still speculative, if the config ends up headless anyway the platform layer is shut down again below.
+        if (bIsPlatformNeeded)
+        {
+            StartupPhaseTimer timer(startupTiming_, StartupPhase::Platform);
             windowHandler_ = std::make_unique<GLFWWindowHandler>();
-            if (!windowHandler_->InitializeWindow(config_->GetWindowWidth(), config_->GetWindowHeight(), config_->GetEngineName()))
+            windowHandler_->InitializeBackend();
+        }
+        configTask.get();
+
+        if (mode_ == Mode::Standalone || mode_ == Mode::Headless)
+        {
+            frameArena_ = std::make_unique<FrameArena>(static_cast<size_t>(std::max(config_->GetFrameArenaKilobytes(), 1)) * 1024);
+            if (config_->IsHeadless())
+            {
+                mode_ = Mode::Headless;
+            }
+
+            // Replays run headless and unpaced, fed entirely from the recorded session.
+            const std::string replayFile = config_->GetReplayFile();
+            if (!replayFile.empty())
             {
-                return;
+                frameReplayer_ = std::make_unique<FrameReplayer>();
+                if (frameReplayer_->Open(outputDir + replayFile))
+                {
+                    mode_ = Mode::Headless;
+                }
+                else
+                {
+                    frameReplayer_.reset();
+                }
             }
 
-            if (!inputHandler_.Initialize(windowHandler_.get()))
+            DEBUG_LOG(LOG::INFO, "{} mode activated. Please standby.", mode_ == Mode::Headless ? "Headless" : "Standalone");
+
+            clock_->SetFPS(config_->GetMaxFPS());
+            clock_->SetTimeScale(config_->GetTimeScale());
+            clock_->SetPaused(config_->IsTimePaused());
+            if (clock_->GetTimeScale() != 1.0 || clock_->IsPaused())
             {
-                return;
+                DEBUG_LOG(LOG::INFO, "Sim time scale: {}x{}", clock_->GetTimeScale(), clock_->IsPaused() ? ", paused" : "");
+            }
+            // Without pacing frames run back to back, for throughput runs such as benchmarks and batch simulations.
+            framePacer_->SetTargetFPS(config_->IsFramePacingEnabled() ? config_->GetMaxFPS() : 0);
+            framePacer_->SetSpinThreshold(std::chrono::microseconds(config_->GetSpinThresholdMicroseconds()));
+
+            frameStats_ = std::make_unique<FrameStatsRecorder>(std::max(config_->GetFrameHistorySize(), 1));
+            frameStats_->SetBudget(config_->GetMaxFPS() > 0 ? SECONDS_TO_NANOSECONDS / config_->GetMaxFPS() : 0);
+            statsLogInterval_ = config_->GetStatsLogInterval();
+            nextStatsLogTime_ = statsLogInterval_;
+
+            const std::string statsCsvFile = config_->GetStatsCsvFile();
+            if (!statsCsvFile.empty())
+            {
+                frameStats_->OpenCsv(outputDir + statsCsvFile);
+            }
+
+            if (config_->IsProfilerCaptureEnabled())
+            {
+                traceFile_ = outputDir + config_->GetProfilerTraceFile();
+                Profiler::SetMaxZones(static_cast<size_t>(std::max(config_->GetProfilerMaxZones(), 0)));
+                AUX_PROFILE_THREAD("Main");
+                Profiler::SetCapturing(true);
+            }
+
+            if (config_->IsHitchWatchdogEnabled())
+            {
+                const uint64_t thresholdTicks = GetHitchThresholdTicks(config_->GetMaxFPS());
+                const std::string hitchCsvFile = config_->GetHitchCsvFile();
+                watchdog_->Start(thresholdTicks, hitchCsvFile.empty() ? "" : outputDir + hitchCsvFile);
+                DEBUG_LOG(LOG::INFO, "Hitch watchdog reporting frames over {:.1f}ms.", static_cast<double>(thresholdTicks) / MILLISECONDS_TO_NANOSECONDS);
+            }
+
+            const int fixedUpdateRate = config_->GetFixedUpdateRate();
+            fixedDeltaTime_ = fixedUpdateRate > 0 ? 1.0 / fixedUpdateRate : 0.0;
+            fixedTimeAccumulator_ = 0.0;
+            maxFixedStepsPerFrame_ = std::max(config_->GetMaxFixedStepsPerFrame(), 1);
+
+            // Only a window needs its events pumped while the app is busy, headless runs and replays stay on one thread.
+            const int simulationRate = config_->GetSimulationRate();
+            simulationDeltaTime_ = config_->IsSimulationThreadEnabled() && mode_ == Mode::Standalone && simulationRate > 0 ? 1.0 / simulationRate : 0.0;
+            simulationPacer_->SetTargetFPS(simulationRate > 0 ? simulationRate : 0);
+            simulationPacer_->SetSpinThreshold(std::chrono::microseconds(config_->GetSpinThresholdMicroseconds()));
+
+            // Headless and unpaced runs are measuring throughput, throttling them would skew the results.
+            bAdaptivePacing_ = config_->IsAdaptivePacingEnabled() && config_->IsFramePacingEnabled() && mode_ != Mode::Headless;
+            powerModeFPS_[static_cast<size_t>(PowerMode::Active)] = 0;
+            powerModeFPS_[static_cast<size_t>(PowerMode::Unfocused)] = std::max(config_->GetUnfocusedFPS(), 0);
+            powerModeFPS_[static_cast<size_t>(PowerMode::Idle)] = std::max(config_->GetIdleFPS(), 0);
+            powerModeFPS_[static_cast<size_t>(PowerMode::Minimized)] = std::max(config_->GetMinimizedFPS(), 0);
+            idleTimeoutTicks_ = static_cast<uint64_t>(std::max(config_->GetIdleTimeoutSeconds(), 0.0f) * SECONDS_TO_NANOSECONDS);
+
+            if (mode_ == Mode::Headless)
+            {
+                if (windowHandler_)
+                {
+                    windowHandler_->Shutdown();
+                }
+                windowHandler_ = std::make_unique<NullWindowHandler>();
+                nullInputHandler_ = std::make_unique<NullInputHandler>();
+                inputHandler_ = nullInputHandler_.get();
+            }
+            else
+            {
+                // Created by the platform phase above, unless the ini file asked for a replay that failed to open.
+                if (!windowHandler_)
+                {
+                    StartupPhaseTimer timer(startupTiming_, StartupPhase::Platform);
+                    windowHandler_ = std::make_unique<GLFWWindowHandler>();
+                    windowHandler_->InitializeBackend();
+                }
+                inputHandler_ = glfwInputHandler_.get();
+
+                // GLFW only reads gamepads on the main thread, so they are sampled there while it waits for the next frame.
+                const int gamepadSampleRate = config_->GetGamepadSampleRate();
+                if (gamepadSampleRate > 0)
+                {
+                    framePacer_->SetSleepTask([this]() { glfwInputHandler_->SampleGamepads(); }, std::chrono::microseconds(1'000'000 / gamepadSampleRate));
+                }
+            }
+
+            windowHandler_->SetEventBus(eventBus_.get());
+            inputHandler_->SetEventBus(eventBus_.get());
+
+            {
+                StartupPhaseTimer timer(startupTiming_, StartupPhase::Window);
+                if (!windowHandler_->InitializeWindow(config_->GetWindowWidth(), config_->GetWindowHeight(), config_->GetEngineName()))
+                {
+                    return;
+                }
+            }
+
+            {
+                StartupPhaseTimer timer(startupTiming_, StartupPhase::Input);
+                if (!inputHandler_->Initialize(windowHandler_.get()))
+                {
+                    return;
+                }
+            }
+
+            // A recording holds one frame per main loop iteration, but with a simulation thread the app steps at its own fixed rate,
+            // so replaying those frames could not reproduce the session.
+            const std::string recordFile = config_->GetRecordFile();
+            if (!recordFile.empty() && simulationDeltaTime_ > 0.0)
+            {
+                DEBUG_LOG(LOG::WARNING, "Recording is not supported with the simulation thread enabled, {} will not be recorded.", recordFile);
+            }
+            else if (!recordFile.empty() && !frameReplayer_)
+            {
+                frameRecorder_ = std::make_unique<FrameRecorder>();
+                if (frameRecorder_->Open(outputDir + recordFile))
+                {
+                    inputHandler_->SetRecorder(frameRecorder_.get());
+                }
+                else
+                {
+                    frameRecorder_.reset();
+                }
             }
         }
         else 
         {
             DEBUG_LOG(LOG::INFO, "Auxiliary mode activated. Please standby.");
-            // Auxiliary Mode, do nothing.
+            // Auxiliary Mode, no window. The host drives frames through Tick and TickUntil and feeds input through the null input handler.
+            nullInputHandler_ = std::make_unique<NullInputHandler>();
+            inputHandler_ = nullInputHandler_.get();
+            inputHandler_->SetEventBus(eventBus_.get());
+            inputHandler_->Initialize(nullptr);
+        }
+
+        {
+            StartupPhaseTimer timer(startupTiming_, StartupPhase::Jobs);
+            // Auxiliary mode must not add threads to its host, frame graph and coroutine jobs run inline on the ticking thread.
+            // A workerThreads setting of 0 or less means one worker per hardware thread.
+            const int workerThreadCount = config_ && config_->GetWorkerThreadCount() > 0 ? config_->GetWorkerThreadCount() : -1;
+            // Jobs reach this engine's services rather than the default engine's, coroutines started in a job included.
+            jobSystem_ = std::make_unique<JobSystem>(mode_ == Mode::Auxiliary ? 0 : workerThreadCount, [this]() { ServiceRegistry::SetCurrent(&services_); });
         }
+        DEBUG_LOG(LOG::INFO, "Job system started with {} workers.", jobSystem_->GetWorkerCount());
 
+        RegisterServices();
+        ServiceRegistry::SetCurrent(&services_);
+
+        clock_->Reset();
+        lastActivityTicks_ = clock_->GetCurrentTicks();
         isRunning_ = true;
 
+        if (preloadTask.valid())
+        {
+            preloadTask.get();
+        }
+        startupTiming_.totalTicks = EngineClock::GetCurrentTimeInNanoSeconds() - startupBegin;
+        LogStartupTiming(startupTiming_);
+
         DEBUG_LOG(LOG::INFO, "Wake up protocol complete!");
+
+        if (startupApp && !LoadApp(startupApp.release()))
+        {
+            DEBUG_LOG(LOG::WARNING, "App failed to enter.");
+        }
     }
 
     bool Engine::LoadApp(App* app)
@@ -128,19 +759,62 @@ namespace  AuxEngine
         {
             return false;
         }
+        // The outgoing app's systems point into it.
+        systems_->Clear();
         app_.reset(app);
+        ServiceRegistry::SetCurrent(&services_);
+        app_->RegisterSystems(*systems_);
         return app_->Enter();
     }
 
     void Engine::Run()
     {
-        if (mode_ == Mode::Standalone)
+        if (frameReplayer_)
+        {
+            RunReplay();
+        }
+        else if (mode_ != Mode::Auxiliary)
         {
+            framePacer_->Reset();
+            StartSimulationThread();
+
             while (isRunning_)
             {
                 clock_->UpdateFrameTicks();
-                Update(clock_->GetDeltaTime());
-                std::this_thread::sleep_for(std::chrono::milliseconds(clock_->GetSleepTime(clock_->GetFPS()))); // TODO: Replace sleep with Busy-Wait.
+                Update(clock_->GetDeltaTimeAsDouble());
+                UpdatePowerMode();
+
+                // Throttled frames block on window events rather than the pacer, so the first input wakes them straight away.
+                const bool bIsThrottled = powerMode_ != PowerMode::Active;
+                const uint64_t frameDeadline = bIsThrottled
+                    ? clock_->GetCurrentTicks() + SECONDS_TO_NANOSECONDS / powerModeFPS_[static_cast<size_t>(powerMode_)]
+                    : framePacer_->GetFrameDeadlineTicks();
+
+                // Spend leftover frame time on deferred work, stopping short of the spin window so the wake-up stays accurate.
+                // Unpaced frames have no leftover time, so deferred work waits until pacing is enabled.
+                // The simulation thread drains it itself while it runs.
+                if (frameDeadline > 0 && !IsSimulationThreaded())
+                {
+                    const uint64_t spinTicks = std::chrono::duration_cast<std::chrono::nanoseconds>(framePacer_->GetSpinThreshold()).count();
+                    RunDeferredWork(frameDeadline > spinTicks ? frameDeadline - spinTicks : 0);
+                }
+
+                const uint64_t sleepStart = EngineClock::GetCurrentTimeInNanoSeconds();
+                watchdog_->SetPhase(FramePhase::Sleep);
+                if (bIsThrottled)
+                {
+                    if (sleepStart < frameDeadline)
+                    {
+                        // A throttled frame sleeps far past the active budget on purpose.
+                        watchdog_->AllowFrameTime(frameDeadline - clock_->GetCurrentTicks());
+                        windowHandler_->WaitEvents((frameDeadline - sleepStart) * NANOSECONDS_TO_SECONDS);
+                    }
+                }
+                else
+                {
+                    framePacer_->WaitForNextFrame();
+                }
+                RecordFrame(EngineClock::GetCurrentTimeInNanoSeconds() - sleepStart);
             }
 
             if (!isRunning_)
@@ -150,26 +824,142 @@ namespace  AuxEngine
         }
     }
 
+    void Engine::RunReplay()
+    {
+        DEBUG_LOG(LOG::INFO, "Replaying recorded session...");
+
+        const uint64_t replayStart = EngineClock::GetCurrentTimeInNanoSeconds();
+        double deltaTime = 0.0;
+        while (isRunning_ && frameReplayer_->ReadFrame(deltaTime, *inputHandler_))
+        {
+            clock_->UpdateFrameTicks();
+            Update(deltaTime);
+            RecordFrame(0);
+        }
+
+        const double replaySeconds = (EngineClock::GetCurrentTimeInNanoSeconds() - replayStart) * NANOSECONDS_TO_SECONDS;
+        const uint64_t frameCount = frameReplayer_->GetFramesRead();
+        DEBUG_LOG(LOG::INFO, "Replayed {} frames in {:.3f}s, {:.1f} frames per second.",
+            frameCount, replaySeconds, replaySeconds > 0.0 ? frameCount / replaySeconds : 0.0);
+
+        Shutdown();
+    }
+
+    NextFrameAwaiter Engine::NextFrame()
+    {
+        return AuxEngine::NextFrame();
+    }
+
+    bool Engine::Tick(const double deltaTime)
+    {
+        if (!isRunning_)
+        {
+            return false;
+        }
+
+        clock_->UpdateFrameTicks();
+        Update(deltaTime);
+        RunDeferredWork(std::numeric_limits<uint64_t>::max());
+        RecordFrame(0);
+
+        return isRunning_;
+    }
+
+    bool Engine::TickUntil(const uint64_t deadlineTicks)
+    {
+        if (!isRunning_)
+        {
+            return false;
+        }
+
+        clock_->UpdateFrameTicks();
+        Update(clock_->GetDeltaTimeAsDouble());
+        RunDeferredWork(deadlineTicks);
+        RecordFrame(0);
+
+        return isRunning_;
+    }
+
     void Engine::Shutdown()
     {
         DEBUG_LOG(LOG::INFO, "Shutting down...");
+        ServiceRegistry::SetCurrent(&services_);
+
+        if (watchdog_->IsRunning())
+        {
+            watchdog_->Stop();
+            DEBUG_LOG(LOG::INFO, "Hitch watchdog caught {} hitches.", watchdog_->GetHitchCount());
+        }
+
+        // Everything below tears down what the simulation thread uses.
+        StopSimulationThread();
+
+        if (framePacer_->GetTargetFPS() > 0)
+        {
+            DEBUG_LOG(LOG::INFO, "Frame pacing wake-up error avg: {:.1f}us max: {:.1f}us missed deadlines: {}",
+                framePacer_->GetAverageWakeErrorMicroseconds(), framePacer_->GetMaxWakeErrorMicroseconds(), framePacer_->GetMissedDeadlineCount());
+        }
+
+        if (deferredWork_->GetStarvedCount() > 0)
+        {
+            DEBUG_LOG(LOG::WARNING, "Deferred work was held back {} times for not fitting the frame, estimated item cost {:.1f}ms.",
+                deferredWork_->GetStarvedCount(), static_cast<double>(deferredWork_->GetEstimatedCostTicks()) / MILLISECONDS_TO_NANOSECONDS);
+        }
+
+        DEBUG_LOG(LOG::INFO, "Frame arena high water mark: {}KB of {}KB, frames overflowed: {}",
+            frameArena_->GetHighWaterMark() / 1024, frameArena_->GetCapacity() / 1024, frameArena_->GetOverflowFrameCount());
+        LogAllocationStats(LOG::INFO);
 
         isRunning_ = false;
 
+        if (Profiler::IsCapturing())
+        {
+            Profiler::SetCapturing(false);
+            Profiler::Flush();
+            if (!traceFile_.empty() && Profiler::WriteChromeTrace(traceFile_))
+            {
+                DEBUG_LOG(LOG::INFO, "Wrote {} profile zones to {}, {} dropped.", Profiler::GetZoneCount(), traceFile_, Profiler::GetDroppedZoneCount());
+            }
+            Profiler::Clear();
+        }
+
+        // Suspended coroutines and timer callbacks may point into the app, so they go first.
+        coroutines_->Shutdown(jobSystem_.get());
+        timers_->Clear();
+
         if(app_)
         {
             app_->Exit();
+            systems_->Clear();
             app_.reset();
         }
 
+        if(jobSystem_)
+        {
+            services_.Unregister<JobSystem>();
+            jobSystem_.reset();
+        }
+
+        inputHandler_->SetEventBus(nullptr);
+
+        if(frameRecorder_)
+        {
+            DEBUG_LOG(LOG::INFO, "Recorded {} frames.", frameRecorder_->GetFrameCount());
+            inputHandler_->SetRecorder(nullptr);
+            frameRecorder_.reset();
+        }
+        frameReplayer_.reset();
+
         if(windowHandler_)
         {
+            services_.Unregister<WindowHandler>();
             windowHandler_->Shutdown();
             windowHandler_.reset();
         }
 
         if(config_)
         {
+            services_.Unregister<EngineConfig>();
             config_.reset();
         }
 
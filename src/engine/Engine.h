@@ -3,29 +3,122 @@
 #ifndef AUXENGINE_H
 #define AUXENGINE_H
 
+#include "FrameStats.h"
+#include "Hash.h"
+#include "ServiceRegistry.h"
 #include "Singleton.h"
+#include "jobs/TaskGraph.h"
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <thread>
 
 namespace AuxEngine
 {
     class EngineClock;
     class EngineConfig;
+    class FramePacer;
     class WindowHandler;
     class InputHandler;
+    class GLFWInputHandler;
+    class NullInputHandler;
+    class JobSystem;
+    class SystemScheduler;
     class App;
+    class DeferredWorkQueue;
+    class FrameRecorder;
+    class FrameReplayer;
+    class HitchWatchdog;
+    class TimerService;
+    class FrameArena;
+    class EventBus;
+    class CoroutineScheduler;
+    struct NextFrameAwaiter;
 
     enum Mode 
     {
         Standalone = 0,
-        Auxiliary
+        Auxiliary,
+        Headless    // Standalone loop without a display, input is fed through a NullInputHandler.
+    };
+
+    // How hard the standalone loop runs. Everything but Active is throttled, and the first input snaps back to Active.
+    enum class PowerMode : int
+    {
+        Active = 0,
+        Unfocused,      // The window lost focus
+        Idle,           // Focused, but no input for longer than the idle timeout
+        Minimized,
+        MAX
+    };
+
+    constexpr const char* ToString(PowerMode powerMode)
+    {
+        switch (powerMode)
+        {
+        case PowerMode::Active:     return "Active";
+        case PowerMode::Unfocused:  return "Unfocused";
+        case PowerMode::Idle:       return "Idle";
+        case PowerMode::Minimized:  return "Minimized";
+        default:                    return "Unknown";
+        }
+    }
+
+    // Steps of Engine::Start. Log, Config and Preload run on startup threads while Platform runs on the main thread.
+    enum class StartupPhase : int
+    {
+        Log = 0,        // Log file setup
+        Config,         // Config parse, may write the default ini file
+        Preload,        // App::Preload, only when an app is handed to Start
+        Platform,       // Platform layer, e.g. GLFW, without a window
+        Window,
+        Input,
+        Jobs,           // Job system workers
+        MAX
+    };
+
+    constexpr const char* ToString(StartupPhase phase)
+    {
+        switch (phase)
+        {
+        case StartupPhase::Log:         return "Log";
+        case StartupPhase::Config:      return "Config";
+        case StartupPhase::Preload:     return "Preload";
+        case StartupPhase::Platform:    return "Platform";
+        case StartupPhase::Window:      return "Window";
+        case StartupPhase::Input:       return "Input";
+        case StartupPhase::Jobs:        return "Jobs";
+        default:                        return "Unknown";
+        }
+    }
+
+    struct StartupTiming
+    {
+        uint64_t totalTicks = 0;    // Nanoseconds, all of Engine::Start
+        // Wall time of each phase, 0 for phases that did not run. Overlapping phases add up to more than the total.
+        std::array<uint64_t, static_cast<size_t>(StartupPhase::MAX)> phaseTicks = {};
     };
 
+    // Resources declared by the engine's own frame graph tasks. App tasks can read or write these to order themselves around engine work.
+    namespace FrameResource
+    {
+        static constexpr TaskResourceId Window = COMPILE_TIME_HASH("Window");
+        static constexpr TaskResourceId Input = COMPILE_TIME_HASH("Input");
+        static constexpr TaskResourceId App = COMPILE_TIME_HASH("App");
+        static constexpr TaskResourceId Stats = COMPILE_TIME_HASH("Stats");
+    }
+
+    /*
+    * Engine::Get() is the default instance. Further engines can be constructed directly, for example several headless sims in one process,
+    * each one owns its own services.
+    */
     class Engine : public Singleton<Engine>
     {
         friend class Singleton;
 
-        Engine();
-
     public:
+        Engine();
         Engine(Engine&&) = delete;
         Engine(const Engine&) = delete;
         Engine& operator=(const Engine&) = delete;
@@ -35,26 +128,123 @@ namespace AuxEngine
         
 
     private:
+        ServiceRegistry services_;
         Mode mode_;
-        bool isRunning_;
+        // Cleared from the main thread, read by the simulation thread's app code through IsRunning.
+        std::atomic<bool> isRunning_;
         std::unique_ptr<EngineConfig> config_;
         std::unique_ptr<EngineClock> clock_;
+        std::unique_ptr<FramePacer> framePacer_;
+        std::unique_ptr<FrameStatsRecorder> frameStats_;
+        FrameTiming frameTiming_;
+        double statsLogInterval_;
+        double nextStatsLogTime_;
         std::unique_ptr<WindowHandler> windowHandler_;
-        InputHandler& inputHandler_;
+        std::unique_ptr<GLFWInputHandler> glfwInputHandler_;
+        InputHandler* inputHandler_;
+        std::unique_ptr<NullInputHandler> nullInputHandler_;
+        std::unique_ptr<JobSystem> jobSystem_;
+        std::unique_ptr<TaskGraph> frameGraph_;
+        std::unique_ptr<SystemScheduler> systems_;
+        std::unique_ptr<DeferredWorkQueue> deferredWork_;
+        std::unique_ptr<TimerService> timers_;
+        std::unique_ptr<FrameArena> frameArena_;
+        std::unique_ptr<EventBus> eventBus_;
+        std::unique_ptr<CoroutineScheduler> coroutines_;
+        std::unique_ptr<FrameRecorder> frameRecorder_;
+        std::unique_ptr<FrameReplayer> frameReplayer_;
+        std::unique_ptr<HitchWatchdog> watchdog_;
+        std::string traceFile_;
+        StartupTiming startupTiming_;
+        double frameDeltaTime_;
         std::unique_ptr<App> app_;
 
-        void Update(const float deltaTime);
+        // Adaptive pacing state, a rate of 0 leaves that mode running at the full rate.
+        bool bAdaptivePacing_;
+        PowerMode powerMode_;
+        std::array<unsigned int, static_cast<size_t>(PowerMode::MAX)> powerModeFPS_;
+        uint64_t idleTimeoutTicks_;
+        uint64_t lastActivityTicks_;
+
+        // Fixed timestep state, the step is zero when the fixed timestep is disabled.
+        double fixedDeltaTime_;
+        double fixedTimeAccumulator_;
+        int maxFixedStepsPerFrame_;
+
+        // Simulation thread state, the step is zero when the app updates on the main thread.
+        // While it runs, the simulation thread owns the app, the scaled clock channels, the frame arena, event delivery, timers and coroutines.
+        // The main thread keeps the frame ticks, the window and input polling.
+        double simulationDeltaTime_;
+        std::unique_ptr<FramePacer> simulationPacer_;
+        std::atomic<bool> bIsSimulating_;
+        std::thread simulationThread_;
+
+        void Update(const double deltaTime);
+        void RegisterServices();
+        void BuildFrameGraph();
+        void UpdateWindowEvents();
+        void UpdateInput();
+        void UpdateApp();
+        void StepApp();
+        float StepFixedUpdate(const double deltaTime);
+        void StartSimulationThread();
+        void StopSimulationThread();
+        // A hitch threshold of 0 leaves the simulation thread unwatched.
+        void RunSimulation(const uint64_t hitchThresholdTicks);
+        void StepSimulation();
+        uint64_t GetHitchThresholdTicks(const int targetFPS) const;
+        void RecordFrame(const uint64_t sleepTicks);
+        void RunReplay();
+        void RunDeferredWork(const uint64_t deadlineTicks);
+        void UpdatePowerMode();
+        void ReportFrameStats();
         bool IsStandalone() const;
 
     public:
-        void Start(Mode mode, const char* outputDir = "");
+        // An app given here is preloaded on a startup thread alongside the rest of startup, then loaded as by LoadApp once the engine is up.
+        void Start(Mode mode, const char* outputDir = "", App* app = nullptr);
         bool LoadApp(App* app);
         void Run();
         bool IsRunning() const { return isRunning_; }
         void Shutdown();
 
-        InputHandler& GetInputHandler() const { return inputHandler_; }
+        // Drive a single frame from a host loop, intended for Auxiliary mode where Run does nothing. Both return false once the engine stopped.
+        // Tick uses the host's delta time and then runs all deferred work queued before it started running.
+        // TickUntil measures its own delta time and then runs deferred work until the deadline, in EngineClock nanoseconds.
+        bool Tick(const double deltaTime);
+        bool TickUntil(const uint64_t deadlineTicks);
+
+        // Services of this engine, for code that has no engine reference at hand use ServiceRegistry::GetCurrent.
+        const ServiceRegistry& GetServices() const { return services_; }
+
+        InputHandler& GetInputHandler() const { return *inputHandler_; }
+        // Only valid in Headless and Auxiliary mode, nullptr otherwise.
+        NullInputHandler* GetNullInputHandler() const { return nullInputHandler_.get(); }
+        JobSystem& GetJobSystem() const { return *jobSystem_; }
+        DeferredWorkQueue& GetDeferredWork() const { return *deferredWork_; }
+        TimerService& GetTimers() const { return *timers_; }
+        FrameArena& GetFrameArena() const { return *frameArena_; }
+        EventBus& GetEventBus() const { return *eventBus_; }
+        CoroutineScheduler& GetCoroutines() const { return *coroutines_; }
+
+        // co_await Engine::NextFrame() suspends a coroutine until the next frame.
+        static NextFrameAwaiter NextFrame();
+
+        // Tasks run every frame by Engine::Update. Apps may add their own, the graph recompiles on the next frame.
+        TaskGraph& GetFrameGraph() const { return *frameGraph_; }
+
+        // Systems run in phases around App::OnUpdate during the app step of every frame.
+        SystemScheduler& GetSystems() const { return *systems_; }
         const EngineClock& GetClock() const { return *clock_; }
+        // Time scale, pause and stepping of the Sim and UI channels live on the clock.
+        EngineClock& GetClock() { return *clock_; }
+        PowerMode GetPowerMode() const { return powerMode_; }
+        const FramePacer& GetFramePacer() const { return *framePacer_; }
+        // True while the app updates on the simulation thread, see [Engine] simulationThread. Frame graph tasks stay on the main thread,
+        // input polls such as IsKeyDown answer from the state published with the input the simulation thread last dispatched.
+        bool IsSimulationThreaded() const { return bIsSimulating_.load(std::memory_order_acquire); }
+        FrameStats GetFrameStats() const { return frameStats_->GetStats(); }
+        const StartupTiming& GetStartupTiming() const { return startupTiming_; }
     };
 }
 
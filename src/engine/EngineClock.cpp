@@ -2,15 +2,24 @@
 
 #include "EngineClock.h"
 
+#include <algorithm>
 #include <chrono>
 
 namespace AuxEngine
 {
 	EngineClock::EngineClock() 
-        : prevTicks_(0)
+        : startTicks_(0)
+        , deltaTicks_(0)
         , currentTicks_(0)
+        , frameIndex_(0)
         , fps_(30)
+        , timeScale_(1.0)
+        , bIsPaused_(false)
+        , pendingStepTime_(0.0)
+        , frameStepTime_(0.0)
+        , channels_()
     {
+        channels_[static_cast<size_t>(ClockChannel::UI)].bFollowsGlobalTime = false;
         Reset();
     }
 
@@ -26,54 +35,172 @@ namespace AuxEngine
 
     void EngineClock::Reset()
     {
-        prevTicks_ = currentTicks_ = GetCurrentTimeInMilliSeconds();
+        const uint64_t now = GetCurrentTimeInNanoSeconds();
+        startTicks_.store(now, std::memory_order_relaxed);
+        deltaTicks_.store(0, std::memory_order_relaxed);
+        currentTicks_.store(now, std::memory_order_relaxed);
+        frameIndex_.store(0, std::memory_order_relaxed);
+        frameStepTime_ = 0.0;
+
+        for (ChannelState& channel : channels_)
+        {
+            channel.deltaTime = 0.0;
+            channel.elapsedTime = 0.0;
+        }
     }
 
     void EngineClock::UpdateFrameTicks()
     {
-        prevTicks_ = currentTicks_;
-        currentTicks_ = GetCurrentTimeInMilliSeconds();
+        // The delta is kept on its own, so a reader on another thread never pairs ticks from two different frames.
+        const uint64_t now = GetCurrentTimeInNanoSeconds();
+        deltaTicks_.store(now - currentTicks_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        currentTicks_.store(now, std::memory_order_relaxed);
+        frameIndex_.fetch_add(1, std::memory_order_relaxed);
     }
 
     float EngineClock::GetDeltaTime() const
     {
-        return static_cast<float>(currentTicks_ - prevTicks_) * MILLISECONDS_TO_SECONDS;	// Conversion to seconds
+        return static_cast<float>(GetDeltaTimeAsDouble());
+    }
+
+    double EngineClock::GetDeltaTimeAsDouble() const
+    {
+        return static_cast<double>(GetDeltaTicks()) * NANOSECONDS_TO_SECONDS;	// Conversion to seconds
+    }
+
+    uint64_t EngineClock::GetDeltaTicks() const
+    {
+        return deltaTicks_.load(std::memory_order_relaxed);
+    }
+
+    double EngineClock::GetElapsedTime() const
+    {
+        return static_cast<double>(currentTicks_.load(std::memory_order_relaxed) - startTicks_.load(std::memory_order_relaxed)) * NANOSECONDS_TO_SECONDS;
     }
-    unsigned int EngineClock::GetSleepTime(const unsigned int fps)
+
+    uint64_t EngineClock::GetFrameIndex() const
     {
-        const unsigned int milliSecsPerFrame = SECONDS_TO_MILLISECONDS / fps;
+        return frameIndex_.load(std::memory_order_relaxed);
+    }
 
-        if (milliSecsPerFrame == 0)
+    uint64_t EngineClock::GetCurrentTicks() const
+    {
+        return currentTicks_.load(std::memory_order_relaxed);
+    }
+
+    void EngineClock::SetTimeScale(double timeScale)
+    {
+        timeScale_ = std::max(timeScale, 0.0);
+    }
+
+    double EngineClock::GetTimeScale() const
+    {
+        return timeScale_;
+    }
+
+    void EngineClock::SetPaused(bool bIsPaused)
+    {
+        bIsPaused_ = bIsPaused;
+        pendingStepTime_ = 0.0;
+    }
+
+    bool EngineClock::IsPaused() const
+    {
+        return bIsPaused_;
+    }
+
+    void EngineClock::Step(double stepSeconds)
+    {
+        if (bIsPaused_)
         {
-            return 0;
+            pendingStepTime_ += std::max(stepSeconds, 0.0);
         }
+    }
 
-        const unsigned int sleepTime = milliSecsPerFrame - GetCurrentTimeInMilliSeconds();
+    double EngineClock::GetFrameStepTime() const
+    {
+        return frameStepTime_;
+    }
+
+    void EngineClock::SetChannelTimeScale(ClockChannel channel, double timeScale)
+    {
+        channels_[static_cast<size_t>(channel)].timeScale = std::max(timeScale, 0.0);
+    }
+
+    double EngineClock::GetChannelTimeScale(ClockChannel channel) const
+    {
+        return channels_[static_cast<size_t>(channel)].timeScale;
+    }
+
+    void EngineClock::SetChannelPaused(ClockChannel channel, bool bIsPaused)
+    {
+        channels_[static_cast<size_t>(channel)].bIsPaused = bIsPaused;
+    }
+
+    bool EngineClock::IsChannelPaused(ClockChannel channel) const
+    {
+        return channels_[static_cast<size_t>(channel)].bIsPaused;
+    }
+
+    void EngineClock::SetChannelFollowsGlobalTime(ClockChannel channel, bool bFollowsGlobalTime)
+    {
+        channels_[static_cast<size_t>(channel)].bFollowsGlobalTime = bFollowsGlobalTime;
+    }
 
-        if (sleepTime > milliSecsPerFrame)
+    double EngineClock::GetChannelEffectiveScale(ClockChannel channel) const
+    {
+        const ChannelState& state = channels_[static_cast<size_t>(channel)];
+        if (state.bIsPaused || (state.bFollowsGlobalTime && bIsPaused_))
         {
-            return milliSecsPerFrame;
+            return 0.0;
+        }
+        return state.bFollowsGlobalTime ? timeScale_ * state.timeScale : state.timeScale;
+    }
+
+    double EngineClock::GetChannelDeltaTime(ClockChannel channel) const
+    {
+        return channels_[static_cast<size_t>(channel)].deltaTime;
+    }
+
+    double EngineClock::GetChannelElapsedTime(ClockChannel channel) const
+    {
+        return channels_[static_cast<size_t>(channel)].elapsedTime;
+    }
+
+    double EngineClock::AdvanceScaledTime(double deltaTime)
+    {
+        for (size_t i = 0; i < channels_.size(); ++i)
+        {
+            ChannelState& state = channels_[i];
+            state.deltaTime = std::max(deltaTime, 0.0) * GetChannelEffectiveScale(static_cast<ClockChannel>(i));
+
+            // A step moves a paused clock forward by exactly the requested time, independent of how long the frame took.
+            if (bIsPaused_ && state.bFollowsGlobalTime && !state.bIsPaused)
+            {
+                state.deltaTime += pendingStepTime_ * state.timeScale;
+            }
+            state.elapsedTime += state.deltaTime;
         }
+        frameStepTime_ = bIsPaused_ ? pendingStepTime_ : 0.0;
+        pendingStepTime_ = 0.0;
 
-        return sleepTime;
+        return channels_[static_cast<size_t>(ClockChannel::Sim)].deltaTime;
     }
 
-    int EngineClock::GetCurrentTicks() const
+    uint64_t EngineClock::GetCurrentTimeInNanoSeconds()
     {
-        return  currentTicks_;
+        const auto now = std::chrono::steady_clock::now();
+        const auto nanos = std::chrono::time_point_cast<std::chrono::nanoseconds>(now).time_since_epoch();
+        return static_cast<uint64_t>(nanos.count());
     }
 
-    unsigned int EngineClock::GetCurrentTimeInMicroSeconds() const
+    uint64_t EngineClock::GetCurrentTimeInMicroSeconds()
     {
-        const auto now = std::chrono::high_resolution_clock::now();
-        const auto micros = std::chrono::time_point_cast<std::chrono::microseconds>(now).time_since_epoch();
-        return static_cast<unsigned int>(micros.count());
+        return GetCurrentTimeInNanoSeconds() / MICROSECONDS_TO_NANOSECONDS;
     }
 
-    unsigned int EngineClock::GetCurrentTimeInMilliSeconds() const
+    uint64_t EngineClock::GetCurrentTimeInMilliSeconds()
     {
-        const auto now = std::chrono::high_resolution_clock::now();
-        const auto millis = std::chrono::time_point_cast<std::chrono::milliseconds>(now).time_since_epoch();
-        return static_cast<unsigned int>(millis.count());
+        return GetCurrentTimeInNanoSeconds() / MILLISECONDS_TO_NANOSECONDS;
     }
-}
\ No newline at end of file
+}
@@ -3,6 +3,11 @@
 #ifndef AUX_ENGINECLOCK_H
 #define AUX_ENGINECLOCK_H
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
 #ifndef MILLISECONDS_TO_SECONDS
 #define MILLISECONDS_TO_SECONDS (1 / 1000.0f)
 #endif
@@ -27,8 +32,48 @@
 #define MICROSECONDS_TO_MILLISECONDS (1 / 1000.0f)
 #endif
 
+#ifndef NANOSECONDS_TO_SECONDS
+#define NANOSECONDS_TO_SECONDS (1 / 1000000000.0)
+#endif
+
+#ifndef SECONDS_TO_NANOSECONDS
+#define SECONDS_TO_NANOSECONDS (1000000000ull / 1)
+#endif
+
+#ifndef MILLISECONDS_TO_NANOSECONDS
+#define MILLISECONDS_TO_NANOSECONDS (1000000ull / 1)
+#endif
+
+#ifndef MICROSECONDS_TO_NANOSECONDS
+#define MICROSECONDS_TO_NANOSECONDS (1000ull / 1)
+#endif
+
 namespace AuxEngine
 {
+    // Independently scaled time lines derived from the frame delta.
+    enum class ClockChannel : int
+    {
+        Sim = 0,    // App updates, systems, fixed steps, timers and coroutine delays
+        UI,         // Ignores the global time scale and pause, so menus keep running while the simulation is frozen
+        MAX
+    };
+
+    constexpr const char* ToString(ClockChannel channel)
+    {
+        switch (channel)
+        {
+        case ClockChannel::Sim: return "Sim";
+        case ClockChannel::UI:  return "UI";
+        default:                return "Unknown";
+        }
+    }
+
+    /*
+    * Monotonic frame clock. Ticks are 64-bit nanoseconds read from std::chrono::steady_clock.
+    * All timestamps handed out by the engine (frames, input events) share this timebase.
+    * The main thread advances the frame ticks, any thread may read them. Time dilation and the channels belong to the thread that updates the app,
+    * that is the simulation thread while one runs (see Engine::IsSimulationThreaded) and the main thread otherwise.
+    */
     class EngineClock
     {
     public:
@@ -44,19 +89,78 @@ namespace AuxEngine
 
         void Reset();
         void UpdateFrameTicks();
+
+        // Time between the last two calls to UpdateFrameTicks, in seconds. Main thread frames, the simulation thread steps by its own fixed delta.
         float GetDeltaTime() const;
-        unsigned int GetSleepTime(const unsigned int fps);
-        int GetCurrentTicks() const; // Current time in milliseconds
+        double GetDeltaTimeAsDouble() const;
+        uint64_t GetDeltaTicks() const;     // Nanoseconds
+
+        // Time since the clock was last reset, up to the current frame, in seconds.
+        double GetElapsedTime() const;
+
+        // Number of frames since the clock was last reset.
+        uint64_t GetFrameIndex() const;
+
+        uint64_t GetCurrentTicks() const; // Start of the current frame in nanoseconds
+
+        /*
+        * Time dilation, only from the thread that updates the app. The global scale and pause apply to channels that follow global time,
+        * each channel adds its own scale and pause on top. Frame ticks and GetDeltaTime always stay in real time.
+        */
+        void SetTimeScale(double timeScale);
+        double GetTimeScale() const;
+        void SetPaused(bool bIsPaused);
+        bool IsPaused() const;
+
+        // While paused, advances the channels that follow global time by this many seconds on the next frame, scaled per channel.
+        void Step(double stepSeconds);
+        // Step time the current frame advanced by, in unscaled seconds. 0 on frames without a step.
+        double GetFrameStepTime() const;
+
+        void SetChannelTimeScale(ClockChannel channel, double timeScale);
+        double GetChannelTimeScale(ClockChannel channel) const;
+        void SetChannelPaused(ClockChannel channel, bool bIsPaused);
+        bool IsChannelPaused(ClockChannel channel) const;
+        void SetChannelFollowsGlobalTime(ClockChannel channel, bool bFollowsGlobalTime);
+
+        // Combined scale a channel runs at this frame, 0 while paused.
+        double GetChannelEffectiveScale(ClockChannel channel) const;
+
+        // Scaled time of a channel during the current frame and since the clock was reset, in seconds.
+        double GetChannelDeltaTime(ClockChannel channel) const;
+        double GetChannelElapsedTime(ClockChannel channel) const;
+
+        // Advances every channel by a real frame delta, in seconds. Returns the Sim channel's delta.
+        double AdvanceScaledTime(double deltaTime);
 
     private:
-        unsigned int prevTicks_;
-        unsigned int currentTicks_;
+        struct ChannelState
+        {
+            double timeScale = 1.0;
+            double deltaTime = 0.0;
+            double elapsedTime = 0.0;
+            bool bIsPaused = false;
+            bool bFollowsGlobalTime = true;
+        };
+
+        // Atomic, the simulation thread reads them while the main thread starts frames.
+        std::atomic<uint64_t> startTicks_;
+        std::atomic<uint64_t> deltaTicks_;
+        std::atomic<uint64_t> currentTicks_;
+        std::atomic<uint64_t> frameIndex_;
         unsigned int fps_;
 
+        double timeScale_;
+        bool bIsPaused_;
+        double pendingStepTime_;
+        double frameStepTime_;
+        std::array<ChannelState, static_cast<size_t>(ClockChannel::MAX)> channels_;
+
     public:
-        unsigned int GetCurrentTimeInMicroSeconds() const;
-        unsigned int GetCurrentTimeInMilliSeconds() const;
+        static uint64_t GetCurrentTimeInNanoSeconds();
+        static uint64_t GetCurrentTimeInMicroSeconds();
+        static uint64_t GetCurrentTimeInMilliSeconds();
     };
 }
 
-#endif // !AUX_ENGINECLOCK_H
\ No newline at end of file
+#endif // !AUX_ENGINECLOCK_H
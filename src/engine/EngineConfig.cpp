@@ -9,16 +9,76 @@
 namespace  AuxEngine
 {
 	static const std::string ConfigFileName("config/AuxEngine.ini");
+	static const std::string EngineSection("Engine");
 	static const std::string WindowSection("Window");
 	static const std::string GraphicsSection("Graphics");
+	static const std::string TimeSection("Time");
+	static const std::string PowerSection("Power");
+	static const std::string StatsSection("Stats");
+	static const std::string InputSection("Input");
+	static const std::string ReplaySection("Replay");
+	static const std::string ProfilerSection("Profiler");
+	static const std::string WatchdogSection("Watchdog");
 
-	EngineConfig::EngineConfig(const std::string& outputDir)
-		: iniParser_("")
+	EngineConfig::EngineConfig(const std::string& outputDir, IniParser iniParser)
+		: iniParser_(std::move(iniParser))
 	{
+		// What FileUtils::CreateIniFile does, on the settings already read rather than parsing the file again.
 		const std::string configFile = outputDir + ConfigFileName;
-		FileUtils::CreateIniFile(configFile, { WindowSection, GraphicsSection });
-		iniParser_ = IniParser(configFile);
-		iniParser_.Read();
+		if (!FileUtils::CreateFileAtPath(configFile))
+		{
+			DEBUG_LOG(LOG::ERRORLOG, "Failed to create ini file {}", configFile);
+			return;
+		}
+
+		for (const std::string& section : { EngineSection, WindowSection, GraphicsSection, TimeSection, PowerSection, StatsSection, InputSection, ReplaySection, ProfilerSection, WatchdogSection })
+		{
+			iniParser_.AddSection(section);
+		}
+
+		if (!iniParser_.Write())
+		{
+			DEBUG_LOG(LOG::ERRORLOG, "Failed to save sections to ini file {}", configFile);
+		}
+	}
+
+	IniParser EngineConfig::ReadIniFile(const std::string& outputDir)
+	{
+		IniParser iniParser(outputDir + ConfigFileName);
+		iniParser.Read();
+		return iniParser;
+	}
+
+	bool EngineConfig::IsHeadlessRequested(IniParser& iniParser)
+	{
+		// Looking a key up adds it, these settings must not be written back as empty keys.
+		return (iniParser.HasValue(EngineSection, "headless") && iniParser.GetBoolean(EngineSection, "headless", false))
+			|| (iniParser.HasValue(ReplaySection, "replayFile") && !iniParser.GetString(ReplaySection, "replayFile", "").empty());
+	}
+
+	int EngineConfig::GetWorkerThreadCount()
+	{
+		return iniParser_.GetInteger(EngineSection, "workerThreads", 0);
+	}
+
+	bool EngineConfig::IsHeadless()
+	{
+		return iniParser_.GetBoolean(EngineSection, "headless", false);
+	}
+
+	int EngineConfig::GetFrameArenaKilobytes()
+	{
+		return iniParser_.GetInteger(EngineSection, "frameArenaKB", 1024);
+	}
+
+	bool EngineConfig::IsSimulationThreadEnabled()
+	{
+		return iniParser_.GetBoolean(EngineSection, "simulationThread", false);
+	}
+
+	int EngineConfig::GetSimulationRate()
+	{
+		return iniParser_.GetInteger(EngineSection, "simulationRate", 60);
 	}
 
 	std::string EngineConfig::GetEngineName()
@@ -40,4 +100,124 @@ namespace  AuxEngine
 	{
 		return iniParser_.GetInteger(GraphicsSection, "maxFPS", 30);
 	}
+
+	int EngineConfig::GetFixedUpdateRate()
+	{
+		return iniParser_.GetInteger(GraphicsSection, "fixedUpdateRate", 0);
+	}
+
+	int EngineConfig::GetMaxFixedStepsPerFrame()
+	{
+		return iniParser_.GetInteger(GraphicsSection, "maxFixedStepsPerFrame", 5);
+	}
+
+	int EngineConfig::GetSpinThresholdMicroseconds()
+	{
+		return iniParser_.GetInteger(GraphicsSection, "spinThresholdMicroseconds", 1500);
+	}
+
+	bool EngineConfig::IsFramePacingEnabled()
+	{
+		return iniParser_.GetBoolean(GraphicsSection, "framePacing", true);
+	}
+
+	float EngineConfig::GetTimeScale()
+	{
+		return iniParser_.GetFloat(TimeSection, "timeScale", 1.0f);
+	}
+
+	bool EngineConfig::IsTimePaused()
+	{
+		return iniParser_.GetBoolean(TimeSection, "paused", false);
+	}
+
+	bool EngineConfig::IsAdaptivePacingEnabled()
+	{
+		return iniParser_.GetBoolean(PowerSection, "adaptivePacing", true);
+	}
+
+	int EngineConfig::GetUnfocusedFPS()
+	{
+		return iniParser_.GetInteger(PowerSection, "unfocusedFPS", 15);
+	}
+
+	int EngineConfig::GetIdleFPS()
+	{
+		return iniParser_.GetInteger(PowerSection, "idleFPS", 10);
+	}
+
+	int EngineConfig::GetMinimizedFPS()
+	{
+		return iniParser_.GetInteger(PowerSection, "minimizedFPS", 2);
+	}
+
+	float EngineConfig::GetIdleTimeoutSeconds()
+	{
+		return iniParser_.GetFloat(PowerSection, "idleTimeoutSeconds", 120.0f);
+	}
+
+	int EngineConfig::GetFrameHistorySize()
+	{
+		return iniParser_.GetInteger(StatsSection, "frameHistory", 600);
+	}
+
+	float EngineConfig::GetStatsLogInterval()
+	{
+		return iniParser_.GetFloat(StatsSection, "logIntervalSeconds", 0.0f);
+	}
+
+	std::string EngineConfig::GetStatsCsvFile()
+	{
+		return iniParser_.GetString(StatsSection, "csvFile", "");
+	}
+
+	int EngineConfig::GetGamepadSampleRate()
+	{
+		return iniParser_.GetInteger(InputSection, "gamepadSampleRate", 1000);
+	}
+
+	std::string EngineConfig::GetRecordFile()
+	{
+		return iniParser_.GetString(ReplaySection, "recordFile", "");
+	}
+
+	std::string EngineConfig::GetReplayFile()
+	{
+		return iniParser_.GetString(ReplaySection, "replayFile", "");
+	}
+
+	bool EngineConfig::IsProfilerCaptureEnabled()
+	{
+		return iniParser_.GetBoolean(ProfilerSection, "capture", false);
+	}
+
+	std::string EngineConfig::GetProfilerTraceFile()
+	{
+		return iniParser_.GetString(ProfilerSection, "traceFile", "Trace.json");
+	}
+
+	int EngineConfig::GetProfilerMaxZones()
+	{
+		return iniParser_.GetInteger(ProfilerSection, "maxZones", 1000000);
+	}
+
+	bool EngineConfig::IsHitchWatchdogEnabled()
+	{
+		return iniParser_.GetBoolean(WatchdogSection, "enabled", false);
+	}
+
+	float EngineConfig::GetHitchBudgetMultiplier()
+	{
+		return iniParser_.GetFloat(WatchdogSection, "hitchBudgetMultiplier", 3.0f);
+	}
+
+	int EngineConfig::GetMinHitchMilliseconds()
+	{
+		return iniParser_.GetInteger(WatchdogSection, "minHitchMilliseconds", 50);
+	}
+
+	std::string EngineConfig::GetHitchCsvFile()
+	{
+		return iniParser_.GetString(WatchdogSection, "csvFile", "Hitches.csv");
+	}
 }
\ No newline at end of file
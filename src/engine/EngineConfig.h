@@ -16,9 +16,23 @@ namespace  AuxEngine
         EngineConfig& operator=(const EngineConfig&) = delete;
         EngineConfig& operator=(EngineConfig&&) = delete;
     public:
-        explicit EngineConfig(const std::string& outputDir);
+        // Takes over the settings ReadIniFile returned, so the file is only parsed once. Creates the file and its sections if they are missing.
+        EngineConfig(const std::string& outputDir, IniParser iniParser);
         ~EngineConfig() = default;
 
+        // Only reads the ini file, never creates it or logs, so it can be read before logging is set up. A missing file reads as empty.
+        static IniParser ReadIniFile(const std::string& outputDir);
+
+        // Whether the settings ask for a run without a window, headless or a replay.
+        static bool IsHeadlessRequested(IniParser& iniParser);
+
+        // Engine settings
+        int GetWorkerThreadCount();
+        bool IsHeadless();
+        int GetFrameArenaKilobytes();
+        bool IsSimulationThreadEnabled();
+        int GetSimulationRate();
+
         // Window settings
         std::string GetEngineName();
         int GetWindowWidth();
@@ -26,6 +40,44 @@ namespace  AuxEngine
 
         // Graphics settings
         int GetMaxFPS();
+        int GetFixedUpdateRate();
+        int GetMaxFixedStepsPerFrame();
+        int GetSpinThresholdMicroseconds();
+        bool IsFramePacingEnabled();
+
+        // Time settings
+        float GetTimeScale();
+        bool IsTimePaused();
+
+        // Power settings
+        bool IsAdaptivePacingEnabled();
+        int GetUnfocusedFPS();
+        int GetIdleFPS();
+        int GetMinimizedFPS();
+        float GetIdleTimeoutSeconds();
+
+        // Stats settings
+        int GetFrameHistorySize();
+        float GetStatsLogInterval();
+        std::string GetStatsCsvFile();
+
+        // Input settings
+        int GetGamepadSampleRate();
+
+        // Replay settings
+        std::string GetRecordFile();
+        std::string GetReplayFile();
+
+        // Profiler settings
+        bool IsProfilerCaptureEnabled();
+        std::string GetProfilerTraceFile();
+        int GetProfilerMaxZones();
+
+        // Watchdog settings
+        bool IsHitchWatchdogEnabled();
+        float GetHitchBudgetMultiplier();
+        int GetMinHitchMilliseconds();
+        std::string GetHitchCsvFile();
 
     private:
         IniParser iniParser_;
@@ -0,0 +1,94 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/FrameArena.h"
+
+#include <algorithm>
+
+namespace AuxEngine
+{
+    FrameArena::FrameArena(size_t capacity)
+        : capacity_(capacity)
+        , current_(0)
+        , resource_(*this)
+        , highWaterMark_(0)
+        , overflowFrameCount_(0)
+    {
+        for (Buffer& buffer : buffers_)
+        {
+            buffer.memory = std::make_unique<std::byte[]>(capacity_);
+        }
+    }
+
+    FrameArena::~FrameArena()
+    {
+        for (Buffer& buffer : buffers_)
+        {
+            ReleaseOverflow(buffer);
+        }
+    }
+
+    void FrameArena::BeginFrame()
+    {
+        const size_t usedBytes = GetUsedBytes();
+        const size_t current = current_.load(std::memory_order_relaxed);
+        highWaterMark_.store(std::max(highWaterMark_.load(std::memory_order_relaxed), usedBytes), std::memory_order_relaxed);
+        if (buffers_[current].overflowBytes.load(std::memory_order_relaxed) > 0)
+        {
+            overflowFrameCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Reset the next buffer before switching to it, so readers of current_ such as GetUsedBytes never see it half cleared.
+        Buffer& buffer = buffers_[current ^ 1];
+        ReleaseOverflow(buffer);
+        buffer.offset.store(0, std::memory_order_relaxed);
+        buffer.overflowBytes.store(0, std::memory_order_relaxed);
+        current_.store(current ^ 1, std::memory_order_release);
+    }
+
+    void* FrameArena::Allocate(size_t size, size_t alignment)
+    {
+        Buffer& buffer = buffers_[current_.load(std::memory_order_acquire)];
+        const uintptr_t base = reinterpret_cast<uintptr_t>(buffer.memory.get());
+
+        size_t offset = buffer.offset.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const size_t alignedOffset = ((base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base;
+            if (alignedOffset + size > capacity_)
+            {
+                return AllocateOverflow(buffer, size, alignment);
+            }
+
+            if (buffer.offset.compare_exchange_weak(offset, alignedOffset + size, std::memory_order_relaxed))
+            {
+                return buffer.memory.get() + alignedOffset;
+            }
+        }
+    }
+
+    size_t FrameArena::GetUsedBytes() const
+    {
+        const Buffer& buffer = buffers_[current_.load(std::memory_order_acquire)];
+        return buffer.offset.load(std::memory_order_relaxed) + buffer.overflowBytes.load(std::memory_order_relaxed);
+    }
+
+    void* FrameArena::AllocateOverflow(Buffer& buffer, size_t size, size_t alignment)
+    {
+        void* block = ::operator new(size, std::align_val_t(alignment));
+        buffer.overflowBytes.fetch_add(size, std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        buffer.overflows.push_back(Overflow(block, alignment));
+        return block;
+    }
+
+    void FrameArena::ReleaseOverflow(Buffer& buffer)
+    {
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        for (const Overflow& overflow : buffer.overflows)
+        {
+            ::operator delete(overflow.block, std::align_val_t(overflow.alignment));
+        }
+        buffer.overflows.clear();
+    }
+}
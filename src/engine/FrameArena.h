@@ -0,0 +1,97 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_FRAMEARENA_H
+#define AUX_FRAMEARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace AuxEngine
+{
+    /*
+    * Frame scoped bump allocator for transient data. Two buffers alternate every frame, so anything allocated
+    * stays valid through the end of the following frame, then is dropped without running destructors.
+    * Allocation is safe from any thread, but nothing may allocate while BeginFrame runs. It is lock-free while the buffer has room,
+    * requests that do not fit take a lock and spill to the heap until the buffer is reused.
+    */
+    class FrameArena
+    {
+        // Adapter so std::pmr containers can draw from the arena. Deallocation is a no-op, memory returns at the frame reset.
+        class Resource : public std::pmr::memory_resource
+        {
+        public:
+            explicit Resource(FrameArena& arena) : arena_(arena) {}
+
+        private:
+            FrameArena& arena_;
+
+            void* do_allocate(size_t bytes, size_t alignment) override { return arena_.Allocate(bytes, alignment); }
+            void do_deallocate(void*, size_t, size_t) override {}
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+        };
+
+        struct Overflow
+        {
+            void* block = nullptr;
+            size_t alignment = 0;
+        };
+
+        struct Buffer
+        {
+            std::unique_ptr<std::byte[]> memory;
+            std::atomic<size_t> offset{ 0 };
+            std::atomic<size_t> overflowBytes{ 0 };
+            std::vector<Overflow> overflows;
+        };
+
+    public:
+        // Capacity of each of the two buffers, in bytes.
+        explicit FrameArena(size_t capacity);
+        FrameArena(const FrameArena&) = delete;
+        FrameArena(FrameArena&&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+        FrameArena& operator=(FrameArena&&) = delete;
+        ~FrameArena();
+
+        // Switches to the other buffer and resets it, releasing everything allocated two frames ago. Call once per frame with no allocations in flight.
+        void BeginFrame();
+
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        // Uninitialised storage for count objects of T.
+        template<typename T>
+        T* AllocateArray(size_t count) { return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))); }
+
+        // For std::pmr containers, e.g. std::pmr::vector<int> values(arena.GetResource());
+        std::pmr::memory_resource* GetResource() { return &resource_; }
+
+        size_t GetCapacity() const { return capacity_; }
+        // Bytes used so far this frame, including heap overflow.
+        size_t GetUsedBytes() const;
+        // Most bytes used in a single frame since the arena was created. Safe to read from any thread, e.g. for stats.
+        size_t GetHighWaterMark() const { return highWaterMark_.load(std::memory_order_relaxed); }
+        // Number of frames that spilled past the buffer onto the heap.
+        uint64_t GetOverflowFrameCount() const { return overflowFrameCount_.load(std::memory_order_relaxed); }
+
+    private:
+        size_t capacity_;
+        Buffer buffers_[2];
+        std::atomic<size_t> current_;
+        Resource resource_;
+
+        std::mutex overflowMutex_;
+        std::atomic<size_t> highWaterMark_;
+        std::atomic<uint64_t> overflowFrameCount_;
+
+        void* AllocateOverflow(Buffer& buffer, size_t size, size_t alignment);
+        void ReleaseOverflow(Buffer& buffer);
+    };
+}
+
+#endif // !AUX_FRAMEARENA_H
@@ -0,0 +1,166 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/FramePacer.h"
+
+#include "engine/CpuRelax.h"
+
+#include <algorithm>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <timeapi.h>	// timeBeginPeriod
+#pragma comment(lib, "Winmm.lib")
+#endif
+
+namespace AuxEngine
+{
+    static constexpr std::chrono::microseconds DefaultSpinThreshold(1500);
+
+    FramePacer::FramePacer()
+        : targetFPS_(0)
+        , framePeriod_(Clock::duration::zero())
+        , spinThreshold_(DefaultSpinThreshold)
+        , nextDeadline_(Clock::now())
+        , sleepTask_()
+        , sleepTaskInterval_(Clock::duration::zero())
+        , lastWakeError_(Clock::duration::zero())
+        , maxWakeError_(Clock::duration::zero())
+        , totalWakeError_(Clock::duration::zero())
+        , wakeCount_(0)
+        , missedDeadlines_(0)
+    {
+#ifdef _WIN32
+        // Default scheduler granularity on Windows is ~15.6ms, far coarser than our spin threshold.
+        timeBeginPeriod(1);
+#endif
+    }
+
+    FramePacer::~FramePacer()
+    {
+#ifdef _WIN32
+        timeEndPeriod(1);
+#endif
+    }
+
+    void FramePacer::SetTargetFPS(unsigned int fps)
+    {
+        targetFPS_ = fps;
+        framePeriod_ = fps > 0
+            ? std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(1'000'000'000 / fps))
+            : Clock::duration::zero();
+        Reset();
+    }
+
+    unsigned int FramePacer::GetTargetFPS() const
+    {
+        return targetFPS_;
+    }
+
+    void FramePacer::SetSpinThreshold(std::chrono::microseconds spinThreshold)
+    {
+        spinThreshold_ = spinThreshold.count() > 0 ? spinThreshold : std::chrono::microseconds::zero();
+    }
+
+    std::chrono::microseconds FramePacer::GetSpinThreshold() const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(spinThreshold_);
+    }
+
+    void FramePacer::SetSleepTask(std::function<void()> task, std::chrono::microseconds interval)
+    {
+        sleepTask_ = std::move(task);
+        sleepTaskInterval_ = std::max(interval, std::chrono::microseconds(1));
+    }
+
+    void FramePacer::Reset()
+    {
+        nextDeadline_ = Clock::now();
+    }
+
+    uint64_t FramePacer::GetFrameDeadlineTicks() const
+    {
+        if (framePeriod_ == Clock::duration::zero())
+        {
+            return 0;
+        }
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>((nextDeadline_ + framePeriod_).time_since_epoch()).count();
+    }
+
+    void FramePacer::WaitForNextFrame()
+    {
+        if (framePeriod_ == Clock::duration::zero())
+        {
+            return;
+        }
+
+        nextDeadline_ += framePeriod_;
+
+        Clock::time_point now = Clock::now();
+        if (now >= nextDeadline_)
+        {
+            ++missedDeadlines_;
+
+            // More than a whole frame behind, re-anchor instead of rushing several short frames to catch up.
+            if (now - nextDeadline_ > framePeriod_)
+            {
+                nextDeadline_ = now;
+            }
+            return;
+        }
+
+        const Clock::time_point spinStart = nextDeadline_ - spinThreshold_;
+        if (now < spinStart && sleepTask_)
+        {
+            while (now < spinStart)
+            {
+                sleepTask_();
+                std::this_thread::sleep_until(std::min(Clock::now() + sleepTaskInterval_, spinStart));
+                now = Clock::now();
+            }
+        }
+        else if (now < spinStart)
+        {
+            std::this_thread::sleep_until(spinStart);
+        }
+
+        while ((now = Clock::now()) < nextDeadline_)
+        {
+            CpuRelax();
+        }
+
+        RecordWakeError(now - nextDeadline_);
+    }
+
+    double FramePacer::GetLastWakeErrorMicroseconds() const
+    {
+        return std::chrono::duration<double, std::micro>(lastWakeError_).count();
+    }
+
+    double FramePacer::GetAverageWakeErrorMicroseconds() const
+    {
+        if (wakeCount_ == 0)
+        {
+            return 0.0;
+        }
+        return std::chrono::duration<double, std::micro>(totalWakeError_).count() / static_cast<double>(wakeCount_);
+    }
+
+    double FramePacer::GetMaxWakeErrorMicroseconds() const
+    {
+        return std::chrono::duration<double, std::micro>(maxWakeError_).count();
+    }
+
+    void FramePacer::RecordWakeError(Clock::duration error)
+    {
+        lastWakeError_ = error;
+        totalWakeError_ += error;
+        ++wakeCount_;
+
+        if (error > maxWakeError_)
+        {
+            maxWakeError_ = error;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_FRAMEPACER_H
+#define AUX_FRAMEPACER_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace AuxEngine
+{
+    /*
+    * Holds the engine loop to a target frame rate.
+    * Deadlines are scheduled on absolute time points, so error from one frame does not carry into the next.
+    * Each wait sleeps until the spin threshold before the deadline, then busy-waits the remainder for accuracy.
+    */
+    class FramePacer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        FramePacer();
+        FramePacer(const FramePacer&) = delete;
+        FramePacer(FramePacer&&) = delete;
+        FramePacer& operator=(const FramePacer&) = delete;
+        FramePacer& operator=(FramePacer&&) = delete;
+        ~FramePacer();
+
+        // A target of 0 disables pacing, WaitForNextFrame will return immediately.
+        void SetTargetFPS(unsigned int fps);
+        unsigned int GetTargetFPS() const;
+
+        // How long before the deadline we stop sleeping and start spinning. Larger values burn more CPU but pace tighter.
+        void SetSpinThreshold(std::chrono::microseconds spinThreshold);
+        std::chrono::microseconds GetSpinThreshold() const;
+
+        // Runs the task about every interval while WaitForNextFrame sleeps, on the waiting thread. For main thread work that benefits from
+        // running between frames, such as sampling input. An empty task sleeps straight through again.
+        void SetSleepTask(std::function<void()> task, std::chrono::microseconds interval);
+
+        // Restarts the schedule so the next deadline is one frame from now.
+        void Reset();
+
+        // Blocks until the deadline of the current frame.
+        void WaitForNextFrame();
+
+        // Deadline the next WaitForNextFrame will wait for, in EngineClock nanoseconds. 0 when pacing is disabled.
+        uint64_t GetFrameDeadlineTicks() const;
+
+        // Signed distance between the deadline and when we actually woke up, positive values mean we woke late.
+        double GetLastWakeErrorMicroseconds() const;
+        double GetAverageWakeErrorMicroseconds() const;
+        double GetMaxWakeErrorMicroseconds() const;
+
+        // Number of frames that missed their deadline before the wait even started.
+        uint64_t GetMissedDeadlineCount() const { return missedDeadlines_; }
+
+    private:
+        unsigned int targetFPS_;
+        Clock::duration framePeriod_;
+        Clock::duration spinThreshold_;
+        Clock::time_point nextDeadline_;
+        std::function<void()> sleepTask_;
+        Clock::duration sleepTaskInterval_;
+
+        Clock::duration lastWakeError_;
+        Clock::duration maxWakeError_;
+        Clock::duration totalWakeError_;
+        uint64_t wakeCount_;
+        uint64_t missedDeadlines_;
+
+        void RecordWakeError(Clock::duration error);
+    };
+}
+
+#endif // !AUX_FRAMEPACER_H
@@ -0,0 +1,215 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/FrameRecording.h"
+
+#include "engine/DebugLog.h"
+
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+namespace AuxEngine
+{
+    static constexpr char RecordingMagic[4] = { 'A', 'U', 'X', 'R' };
+    static constexpr uint32_t RecordingVersion = 1;
+
+    // Buffered bytes are written out once this much has accumulated.
+    static constexpr size_t RecordingFlushSize = 64 * 1024;
+
+    FrameRecorder::~FrameRecorder()
+    {
+        Close();
+    }
+
+    bool FrameRecorder::Open(const std::string& filePath)
+    {
+        Close();
+
+        file_.open(filePath, std::ios::binary | std::ios::trunc);
+        if (!file_.is_open())
+        {
+            DEBUG_LOG(LOG::ERRORLOG, "Failed to open frame recording: {}", filePath);
+            return false;
+        }
+
+        buffer_.reserve(RecordingFlushSize);
+        frameCount_ = 0;
+        for (int i = 0; i < GAMEPAD_COUNT; ++i)
+        {
+            // Values no poll can produce.
+            lastGamepadButtons_[i].fill(-1);
+            lastGamepadAxes_[i].fill(std::numeric_limits<float>::quiet_NaN());
+        }
+
+        buffer_.insert(buffer_.end(), std::begin(RecordingMagic), std::end(RecordingMagic));
+        Write(RecordingVersion);
+        return true;
+    }
+
+    void FrameRecorder::Close()
+    {
+        if (file_.is_open())
+        {
+            Flush();
+            file_.close();
+        }
+    }
+
+    void FrameRecorder::RecordFrame(const double deltaTime)
+    {
+        if (!file_.is_open())
+        {
+            return;
+        }
+
+        Write(FrameRecordType::Frame);
+        Write(deltaTime);
+        ++frameCount_;
+
+        if (buffer_.size() >= RecordingFlushSize)
+        {
+            Flush();
+        }
+    }
+
+    void FrameRecorder::RecordInput(FrameRecordType type, const unsigned int inputDeviceId, const InputEvent& inputEvent)
+    {
+        if (!file_.is_open() || IsUnchangedGamepadInput(type, inputDeviceId, inputEvent))
+        {
+            return;
+        }
+
+        Write(type);
+        Write(static_cast<uint8_t>(inputDeviceId));
+        Write(static_cast<int16_t>(inputEvent.button));
+        Write(static_cast<int8_t>(inputEvent.action));
+        Write(inputEvent.value);
+        Write(inputEvent.timestamp);
+    }
+
+    bool FrameRecorder::IsUnchangedGamepadInput(FrameRecordType type, const unsigned int inputDeviceId, const InputEvent& inputEvent)
+    {
+        // Gamepads take the device ids below the keyboard and mouse.
+        if (inputDeviceId >= GAMEPAD_COUNT || inputEvent.button < 0)
+        {
+            return false;
+        }
+
+        if (type == FrameRecordType::ButtonInput && inputEvent.button < GAMEPAD_BUTTON_COUNT)
+        {
+            int& lastAction = lastGamepadButtons_[inputDeviceId][inputEvent.button];
+            if (lastAction == inputEvent.action)
+            {
+                return true;
+            }
+            lastAction = inputEvent.action;
+        }
+        else if (type == FrameRecordType::AxisInput && inputEvent.button < GAMEPAD_AXIS_COUNT)
+        {
+            float& lastValue = lastGamepadAxes_[inputDeviceId][inputEvent.button];
+            if (lastValue == inputEvent.value)
+            {
+                return true;
+            }
+            lastValue = inputEvent.value;
+        }
+        return false;
+    }
+
+    template<typename T>
+    void FrameRecorder::Write(const T& value)
+    {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+        buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+    }
+
+    void FrameRecorder::Flush()
+    {
+        if (!buffer_.empty())
+        {
+            file_.write(reinterpret_cast<const char*>(buffer_.data()), buffer_.size());
+            buffer_.clear();
+        }
+    }
+
+    bool FrameReplayer::Open(const std::string& filePath)
+    {
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open())
+        {
+            DEBUG_LOG(LOG::ERRORLOG, "Failed to open frame replay: {}", filePath);
+            return false;
+        }
+
+        data_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        readOffset_ = 0;
+        framesRead_ = 0;
+
+        uint32_t version = 0;
+        if (data_.size() < sizeof(RecordingMagic) || std::memcmp(data_.data(), RecordingMagic, sizeof(RecordingMagic)) != 0)
+        {
+            DEBUG_LOG(LOG::ERRORLOG, "Frame replay {} is not a recording.", filePath);
+            data_.clear();
+            return false;
+        }
+        readOffset_ = sizeof(RecordingMagic);
+
+        if (!Read(version) || version != RecordingVersion)
+        {
+            DEBUG_LOG(LOG::ERRORLOG, "Frame replay {} has unsupported version {}, expected {}.", filePath, version, RecordingVersion);
+            data_.clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool FrameReplayer::ReadFrame(double& outDeltaTime, InputHandler& inputHandler)
+    {
+        FrameRecordType type = FrameRecordType::Frame;
+        if (!Read(type) || type != FrameRecordType::Frame || !Read(outDeltaTime))
+        {
+            return false;
+        }
+
+        // Inputs run until the next frame record or the end of the log.
+        while (readOffset_ < data_.size() && static_cast<FrameRecordType>(data_[readOffset_]) != FrameRecordType::Frame)
+        {
+            uint8_t inputDeviceId = 0;
+            int16_t button = 0;
+            int8_t action = 0;
+            InputEvent inputEvent;
+            if (!Read(type) || !Read(inputDeviceId) || !Read(button) || !Read(action) || !Read(inputEvent.value) || !Read(inputEvent.timestamp))
+            {
+                DEBUG_LOG(LOG::WARNING, "Frame replay truncated at frame {}.", framesRead_);
+                return false;
+            }
+            inputEvent.button = button;
+            inputEvent.action = action;
+
+            if (type == FrameRecordType::ButtonInput)
+            {
+                inputHandler.ReplayButtonInput(inputDeviceId, inputEvent);
+            }
+            else
+            {
+                inputHandler.ReplayAxisInput(inputDeviceId, inputEvent);
+            }
+        }
+
+        ++framesRead_;
+        return true;
+    }
+
+    template<typename T>
+    bool FrameReplayer::Read(T& outValue)
+    {
+        if (readOffset_ + sizeof(T) > data_.size())
+        {
+            return false;
+        }
+
+        std::memcpy(&outValue, data_.data() + readOffset_, sizeof(T));
+        readOffset_ += sizeof(T);
+        return true;
+    }
+}
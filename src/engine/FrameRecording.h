@@ -0,0 +1,98 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_FRAMERECORDING_H
+#define AUX_FRAMERECORDING_H
+
+#include "engine/InputHandler.h"
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace AuxEngine
+{
+    /*
+    * Binary session log, written in native byte order:
+    *   Header: "AUXR" magic, uint32 version.
+    *   Frame:  uint8 type, double deltaTime. Starts a frame, every input after it belongs to that frame.
+    *   Input:  uint8 type, uint8 inputDeviceId, int16 button, int8 action, float value, uint64 timestamp.
+    * Gamepads are polled every frame, so their buttons and axes are only written when they change. A replay holds the last value.
+    */
+    enum class FrameRecordType : uint8_t
+    {
+        Frame = 0,
+        ButtonInput,
+        AxisInput
+    };
+
+    // Writes the delta time of every frame and every input event reaching the input handler, except unchanged gamepad state.
+    class FrameRecorder
+    {
+        static constexpr int GAMEPAD_COUNT{ static_cast<int>(GamepadId::MAX) };
+        static constexpr int GAMEPAD_BUTTON_COUNT{ static_cast<int>(GamepadButton::MAX) };
+        static constexpr int GAMEPAD_AXIS_COUNT{ static_cast<int>(GamepadAxis::MAX) };
+
+    public:
+        FrameRecorder() = default;
+        FrameRecorder(const FrameRecorder&) = delete;
+        FrameRecorder(FrameRecorder&&) = delete;
+        FrameRecorder& operator=(const FrameRecorder&) = delete;
+        FrameRecorder& operator=(FrameRecorder&&) = delete;
+        ~FrameRecorder();
+
+        bool Open(const std::string& filePath);
+        void Close();
+        bool IsOpen() const { return file_.is_open(); }
+
+        void RecordFrame(const double deltaTime);
+        void RecordInput(FrameRecordType type, const unsigned int inputDeviceId, const InputEvent& inputEvent);
+
+        uint64_t GetFrameCount() const { return frameCount_; }
+
+    private:
+        std::ofstream file_;
+        std::vector<uint8_t> buffer_;
+        uint64_t frameCount_ = 0;
+
+        // Last gamepad state written, reset on Open so the first poll of every button and axis is written.
+        std::array<std::array<int, GAMEPAD_BUTTON_COUNT>, GAMEPAD_COUNT> lastGamepadButtons_ = {};
+        std::array<std::array<float, GAMEPAD_AXIS_COUNT>, GAMEPAD_COUNT> lastGamepadAxes_ = {};
+
+        bool IsUnchangedGamepadInput(FrameRecordType type, const unsigned int inputDeviceId, const InputEvent& inputEvent);
+
+        template<typename T>
+        void Write(const T& value);
+        void Flush();
+    };
+
+    // Loads a recorded session into memory and feeds it back one frame at a time.
+    class FrameReplayer
+    {
+    public:
+        FrameReplayer() = default;
+        FrameReplayer(const FrameReplayer&) = delete;
+        FrameReplayer(FrameReplayer&&) = delete;
+        FrameReplayer& operator=(const FrameReplayer&) = delete;
+        FrameReplayer& operator=(FrameReplayer&&) = delete;
+        ~FrameReplayer() = default;
+
+        bool Open(const std::string& filePath);
+
+        // Reads the next frame, passing its inputs to the input handler. Returns false once the log is exhausted.
+        bool ReadFrame(double& outDeltaTime, InputHandler& inputHandler);
+
+        uint64_t GetFramesRead() const { return framesRead_; }
+
+    private:
+        std::vector<uint8_t> data_;
+        size_t readOffset_ = 0;
+        uint64_t framesRead_ = 0;
+
+        template<typename T>
+        bool Read(T& outValue);
+    };
+}
+
+#endif // !AUX_FRAMERECORDING_H
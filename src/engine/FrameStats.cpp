@@ -0,0 +1,157 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/FrameStats.h"
+
+#include "engine/DebugLog.h"
+#include "engine/EngineClock.h"
+#include "engine/FileUtils.h"
+#include "engine/parsers/CsvWriter.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+namespace AuxEngine
+{
+    static constexpr double NanosecondsToMilliseconds = 1.0 / MILLISECONDS_TO_NANOSECONDS;
+
+    static double Percentile(std::vector<uint64_t>& sortedTicks, double percentile)
+    {
+        const size_t index = static_cast<size_t>(percentile * static_cast<double>(sortedTicks.size() - 1) + 0.5);
+        return static_cast<double>(sortedTicks[index]) * NanosecondsToMilliseconds;
+    }
+
+    FrameStatsRecorder::FrameStatsRecorder(size_t capacity)
+        : slots_(std::make_unique<Slot[]>(std::max<size_t>(capacity, 1)))
+        , capacity_(std::max<size_t>(capacity, 1))
+        , frameCount_(0)
+        , overBudgetCount_(0)
+        , budgetTicks_(0)
+        , csvFilePath_("")
+    {}
+
+    void FrameStatsRecorder::SetBudget(uint64_t budgetTicks)
+    {
+        budgetTicks_.store(budgetTicks, std::memory_order_relaxed);
+    }
+
+    void FrameStatsRecorder::Record(const FrameTiming& timing)
+    {
+        const uint64_t frame = frameCount_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[frame % capacity_];
+
+        slot.frameTicks.store(timing.frameTicks, std::memory_order_relaxed);
+        for (size_t i = 0; i < timing.phaseTicks.size(); ++i)
+        {
+            slot.phaseTicks[i].store(timing.phaseTicks[i], std::memory_order_relaxed);
+        }
+
+        const uint64_t budget = budgetTicks_.load(std::memory_order_relaxed);
+        const uint64_t sleepTicks = timing.phaseTicks[static_cast<size_t>(FramePhase::Sleep)];
+        const uint64_t workTicks = timing.frameTicks > sleepTicks ? timing.frameTicks - sleepTicks : 0;
+        if (budget > 0 && workTicks > budget)
+        {
+            overBudgetCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Publishing the new count makes the slot visible to readers.
+        frameCount_.store(frame + 1, std::memory_order_release);
+    }
+
+    FrameStats FrameStatsRecorder::GetStats() const
+    {
+        FrameStats stats;
+        stats.totalFrameCount = frameCount_.load(std::memory_order_acquire);
+        stats.totalOverBudgetCount = overBudgetCount_.load(std::memory_order_relaxed);
+
+        const uint64_t budget = budgetTicks_.load(std::memory_order_relaxed);
+        stats.budgetMs = static_cast<double>(budget) * NanosecondsToMilliseconds;
+
+        stats.sampleCount = static_cast<size_t>(std::min<uint64_t>(stats.totalFrameCount, capacity_));
+        if (stats.sampleCount == 0)
+        {
+            return stats;
+        }
+
+        std::vector<uint64_t> frameTicks;
+        frameTicks.reserve(stats.sampleCount);
+
+        uint64_t totalTicks = 0;
+        std::array<uint64_t, static_cast<size_t>(FramePhase::MAX)> totalPhaseTicks = {};
+
+        for (size_t i = 0; i < stats.sampleCount; ++i)
+        {
+            const Slot& slot = slots_[i];
+            const uint64_t ticks = slot.frameTicks.load(std::memory_order_relaxed);
+            frameTicks.push_back(ticks);
+            totalTicks += ticks;
+
+            for (size_t phase = 0; phase < totalPhaseTicks.size(); ++phase)
+            {
+                totalPhaseTicks[phase] += slot.phaseTicks[phase].load(std::memory_order_relaxed);
+            }
+
+            const uint64_t sleepTicks = slot.phaseTicks[static_cast<size_t>(FramePhase::Sleep)].load(std::memory_order_relaxed);
+            if (budget > 0 && ticks > sleepTicks && ticks - sleepTicks > budget)
+            {
+                ++stats.overBudgetCount;
+            }
+        }
+
+        std::sort(frameTicks.begin(), frameTicks.end());
+
+        const double sampleCount = static_cast<double>(stats.sampleCount);
+        stats.minMs = static_cast<double>(frameTicks.front()) * NanosecondsToMilliseconds;
+        stats.maxMs = static_cast<double>(frameTicks.back()) * NanosecondsToMilliseconds;
+        stats.meanMs = static_cast<double>(totalTicks) * NanosecondsToMilliseconds / sampleCount;
+        stats.p50Ms = Percentile(frameTicks, 0.50);
+        stats.p95Ms = Percentile(frameTicks, 0.95);
+        stats.p99Ms = Percentile(frameTicks, 0.99);
+
+        for (size_t phase = 0; phase < totalPhaseTicks.size(); ++phase)
+        {
+            stats.meanPhaseMs[phase] = static_cast<double>(totalPhaseTicks[phase]) * NanosecondsToMilliseconds / sampleCount;
+        }
+
+        return stats;
+    }
+
+    bool FrameStatsRecorder::OpenCsv(const std::string& filePath)
+    {
+        csvFilePath_ = "";
+
+        FileUtils::DeleteFileAtPath(filePath);
+        if (!FileUtils::CreateCsvFile(filePath, { "ElapsedTime", "Frames", "Min", "Mean", "P50", "P95", "P99", "Max",
+            "Update", "Input", "App", "Idle", "Sleep", "Budget", "OverBudget", "TotalOverBudget" }))
+        {
+            return false;
+        }
+
+        csvFilePath_ = filePath;
+        return true;
+    }
+
+    void FrameStatsRecorder::AppendCsv(const FrameStats& stats, double elapsedTime) const
+    {
+        if (csvFilePath_.empty())
+        {
+            return;
+        }
+
+        std::ofstream file(csvFilePath_, std::ios::app);
+        if (!file.is_open())
+        {
+            DEBUG_LOG(LOG::WARNING, "Failed to append frame stats to {}", csvFilePath_);
+            return;
+        }
+
+        auto writer = CsvWriter<std::ofstream, true>::FromCsv(file);
+        writer << std::make_tuple(elapsedTime, stats.sampleCount, stats.minMs, stats.meanMs, stats.p50Ms, stats.p95Ms, stats.p99Ms, stats.maxMs,
+            stats.meanPhaseMs[static_cast<size_t>(FramePhase::Update)],
+            stats.meanPhaseMs[static_cast<size_t>(FramePhase::Input)],
+            stats.meanPhaseMs[static_cast<size_t>(FramePhase::App)],
+            stats.meanPhaseMs[static_cast<size_t>(FramePhase::Idle)],
+            stats.meanPhaseMs[static_cast<size_t>(FramePhase::Sleep)],
+            stats.budgetMs, stats.overBudgetCount, stats.totalOverBudgetCount);
+    }
+}
@@ -0,0 +1,103 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_FRAMESTATS_H
+#define AUX_FRAMESTATS_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace AuxEngine
+{
+    // Parts of a frame that are timed separately.
+    enum class FramePhase : int
+    {
+        Update = 0,     // Engine work outside of input and app, e.g. window event pumping
+        Input = 1,
+        App = 2,
+        Idle = 3,       // Deferred work run in the time left over before the frame deadline
+        Sleep = 4,
+        MAX = 5
+    };
+
+    constexpr const char* ToString(FramePhase phase)
+    {
+        switch (phase)
+        {
+        case FramePhase::Update:    return "Update";
+        case FramePhase::Input:     return "Input";
+        case FramePhase::App:       return "App";
+        case FramePhase::Idle:      return "Idle";
+        case FramePhase::Sleep:     return "Sleep";
+        default:                    return "Unknown";
+        }
+    }
+
+    struct FrameTiming
+    {
+        uint64_t frameTicks = 0;    // Nanoseconds, from the start of the frame to the start of the next one
+        std::array<uint64_t, static_cast<size_t>(FramePhase::MAX)> phaseTicks = {};
+    };
+
+    // Summary of the most recent frames, all times in milliseconds.
+    struct FrameStats
+    {
+        size_t sampleCount = 0;
+        double minMs = 0.0;
+        double meanMs = 0.0;
+        double p50Ms = 0.0;
+        double p95Ms = 0.0;
+        double p99Ms = 0.0;
+        double maxMs = 0.0;
+        std::array<double, static_cast<size_t>(FramePhase::MAX)> meanPhaseMs = {};
+
+        // A frame is over budget when its work, everything except sleep, took longer than the budget.
+        double budgetMs = 0.0;
+        size_t overBudgetCount = 0;         // Within the sampled frames
+        uint64_t totalOverBudgetCount = 0;  // Since the engine started
+        uint64_t totalFrameCount = 0;
+    };
+
+    /*
+    * Keeps the timings of the last N frames in a fixed ring buffer.
+    * Written by the engine thread only, GetStats can be called from any thread without locking.
+    */
+    class FrameStatsRecorder
+    {
+    public:
+        explicit FrameStatsRecorder(size_t capacity);
+        FrameStatsRecorder(const FrameStatsRecorder&) = delete;
+        FrameStatsRecorder(FrameStatsRecorder&&) = delete;
+        FrameStatsRecorder& operator=(const FrameStatsRecorder&) = delete;
+        FrameStatsRecorder& operator=(FrameStatsRecorder&&) = delete;
+        ~FrameStatsRecorder() = default;
+
+        // Frame budget in nanoseconds, 0 disables over budget tracking.
+        void SetBudget(uint64_t budgetTicks);
+
+        void Record(const FrameTiming& timing);
+        FrameStats GetStats() const;
+
+        // Creates the csv file with its headers, every call to AppendCsv adds a row of stats to it.
+        bool OpenCsv(const std::string& filePath);
+        void AppendCsv(const FrameStats& stats, double elapsedTime) const;
+
+    private:
+        struct Slot
+        {
+            std::atomic<uint64_t> frameTicks{ 0 };
+            std::array<std::atomic<uint64_t>, static_cast<size_t>(FramePhase::MAX)> phaseTicks{};
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        size_t capacity_;
+        std::atomic<uint64_t> frameCount_;
+        std::atomic<uint64_t> overBudgetCount_;
+        std::atomic<uint64_t> budgetTicks_;
+        std::string csvFilePath_;
+    };
+}
+
+#endif // !AUX_FRAMESTATS_H
@@ -0,0 +1,249 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/HitchWatchdog.h"
+
+#include "engine/DebugLog.h"
+#include "engine/EngineClock.h"
+#include "engine/FileUtils.h"
+#include "engine/Profiler.h"
+#include "engine/parsers/CsvWriter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+
+namespace AuxEngine
+{
+    static constexpr double NanosecondsToMilliseconds = 1.0 / MILLISECONDS_TO_NANOSECONDS;
+
+    HitchWatchdog::HitchWatchdog()
+        : heartbeats_()
+        , hitchCount_(0)
+        , csvFilePath_("")
+        , thread_()
+        , mutex_()
+        , wakeCondition_()
+        , bStopRequested_(false)
+    {}
+
+    HitchWatchdog::~HitchWatchdog()
+    {
+        Stop();
+    }
+
+    bool HitchWatchdog::Start(uint64_t thresholdTicks, const std::string& csvFilePath)
+    {
+        if (IsRunning())
+        {
+            return false;
+        }
+
+        Watch(WatchedThread::Main, thresholdTicks);
+        if (!csvFilePath.empty() && !OpenCsv(csvFilePath))
+        {
+            DEBUG_LOG(LOG::WARNING, "Hitch watchdog could not create {}, hitches will only be logged.", csvFilePath);
+        }
+
+        Profiler::SetTrackingOpenZones(true);
+        bStopRequested_ = false;
+        thread_ = std::thread(&HitchWatchdog::Run, this);
+        return true;
+    }
+
+    void HitchWatchdog::Stop()
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            bStopRequested_ = true;
+        }
+        wakeCondition_.notify_one();
+        thread_.join();
+        Profiler::SetTrackingOpenZones(false);
+
+        for (int i = 0; i < static_cast<int>(WatchedThread::MAX); ++i)
+        {
+            Unwatch(static_cast<WatchedThread>(i));
+        }
+    }
+
+    void HitchWatchdog::Watch(WatchedThread thread, uint64_t thresholdTicks)
+    {
+        Heartbeat& heartbeat = GetHeartbeat(thread);
+        heartbeat.frameIndex.store(0, std::memory_order_relaxed);
+        heartbeat.threadId.store(Profiler::GetCurrentThreadId(), std::memory_order_relaxed);
+        heartbeat.thresholdTicks.store(std::max<uint64_t>(thresholdTicks, 1), std::memory_order_release);
+    }
+
+    void HitchWatchdog::Unwatch(WatchedThread thread)
+    {
+        GetHeartbeat(thread).thresholdTicks.store(0, std::memory_order_release);
+    }
+
+    void HitchWatchdog::BeginFrame(WatchedThread thread)
+    {
+        Heartbeat& heartbeat = GetHeartbeat(thread);
+        const uint64_t frameIndex = heartbeat.frameIndex.load(std::memory_order_relaxed) + 1;
+        heartbeat.frameStartTicks[frameIndex % FrameHistorySize].store(EngineClock::GetCurrentTimeInNanoSeconds(), std::memory_order_relaxed);
+        heartbeat.allowanceTicks.store(0, std::memory_order_relaxed);
+        heartbeat.phase.store(static_cast<int>(FramePhase::Update), std::memory_order_relaxed);
+        heartbeat.frameIndex.store(frameIndex, std::memory_order_release);
+    }
+
+    void HitchWatchdog::SetPhase(FramePhase phase, WatchedThread thread)
+    {
+        GetHeartbeat(thread).phase.store(static_cast<int>(phase), std::memory_order_relaxed);
+    }
+
+    void HitchWatchdog::AllowFrameTime(uint64_t ticks, WatchedThread thread)
+    {
+        GetHeartbeat(thread).allowanceTicks.store(ticks, std::memory_order_relaxed);
+    }
+
+    uint64_t HitchWatchdog::GetThresholdTicks(WatchedThread thread) const
+    {
+        return heartbeats_[static_cast<size_t>(thread)].thresholdTicks.load(std::memory_order_relaxed);
+    }
+
+    void HitchWatchdog::Run()
+    {
+        AUX_PROFILE_THREAD("Hitch Watchdog");
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!wakeCondition_.wait_for(lock, GetPollInterval(), [this]() { return bStopRequested_; }))
+        {
+            lock.unlock();
+            for (int i = 0; i < static_cast<int>(WatchedThread::MAX); ++i)
+            {
+                Poll(static_cast<WatchedThread>(i));
+            }
+            lock.lock();
+        }
+
+        // Stopped in the middle of a hitch, for example shutting down from a stalled frame. Record what we have.
+        for (int i = 0; i < static_cast<int>(WatchedThread::MAX); ++i)
+        {
+            const Hitch& hitch = heartbeats_[i].hitch;
+            if (hitch.bIsActive)
+            {
+                EndHitch(static_cast<WatchedThread>(i), EngineClock::GetCurrentTimeInNanoSeconds() - hitch.frameStartTicks);
+            }
+        }
+    }
+
+    std::chrono::nanoseconds HitchWatchdog::GetPollInterval() const
+    {
+        uint64_t thresholdTicks = std::numeric_limits<uint64_t>::max();
+        for (const Heartbeat& heartbeat : heartbeats_)
+        {
+            const uint64_t heartbeatThresholdTicks = heartbeat.thresholdTicks.load(std::memory_order_relaxed);
+            if (heartbeatThresholdTicks != 0)
+            {
+                thresholdTicks = std::min(thresholdTicks, heartbeatThresholdTicks);
+            }
+        }
+
+        // Polling several times per threshold keeps detection within a quarter of the tightest one.
+        return std::chrono::nanoseconds(std::clamp<uint64_t>(thresholdTicks / 4, MILLISECONDS_TO_NANOSECONDS, 50 * MILLISECONDS_TO_NANOSECONDS));
+    }
+
+    void HitchWatchdog::Poll(WatchedThread thread)
+    {
+        Heartbeat& heartbeat = GetHeartbeat(thread);
+        Hitch& hitch = heartbeat.hitch;
+        const uint64_t thresholdTicks = heartbeat.thresholdTicks.load(std::memory_order_acquire);
+        const uint64_t frameIndex = heartbeat.frameIndex.load(std::memory_order_acquire);
+
+        // Also ends when the thread stops being watched, it may never beat again.
+        if (hitch.bIsActive && (frameIndex != hitch.frameIndex || thresholdTicks == 0))
+        {
+            // The next frame's start is where the stalled one ended.
+            const bool bIsNextFrameKnown = thresholdTicks != 0 && frameIndex > hitch.frameIndex && frameIndex - hitch.frameIndex < FrameHistorySize;
+            const uint64_t frameEndTicks = bIsNextFrameKnown
+                ? heartbeat.frameStartTicks[(hitch.frameIndex + 1) % FrameHistorySize].load(std::memory_order_relaxed)
+                : EngineClock::GetCurrentTimeInNanoSeconds();
+            EndHitch(thread, frameEndTicks - hitch.frameStartTicks);
+        }
+
+        if (hitch.bIsActive || thresholdTicks == 0 || frameIndex == 0)
+        {
+            return;
+        }
+
+        const uint64_t frameStartTicks = heartbeat.frameStartTicks[frameIndex % FrameHistorySize].load(std::memory_order_relaxed);
+        const FramePhase phase = static_cast<FramePhase>(heartbeat.phase.load(std::memory_order_relaxed));
+        const uint64_t allowanceTicks = heartbeat.allowanceTicks.load(std::memory_order_relaxed);
+        const uint64_t now = EngineClock::GetCurrentTimeInNanoSeconds();
+
+        // A new frame started while we were reading, nothing read belongs together.
+        if (frameIndex != heartbeat.frameIndex.load(std::memory_order_acquire) || now < frameStartTicks)
+        {
+            return;
+        }
+
+        const uint64_t frameTicks = now - frameStartTicks;
+        if (frameTicks <= thresholdTicks + allowanceTicks)
+        {
+            return;
+        }
+
+        hitch.bIsActive = true;
+        hitch.frameIndex = frameIndex;
+        hitch.frameStartTicks = frameStartTicks;
+        hitch.detectedTicks = frameTicks;
+        hitch.thresholdTicks = thresholdTicks;
+        hitch.phase = phase;
+        hitch.openZones = Profiler::GetOpenZones(heartbeat.threadId.load(std::memory_order_relaxed));
+        hitchCount_.fetch_add(1, std::memory_order_relaxed);
+
+        DEBUG_LOG(LOG::WARNING, "Hitch: {} thread frame {} running for {:.1f}ms, over the {:.1f}ms threshold, in phase {}. Open zones: {}",
+            ToString(thread), frameIndex, frameTicks * NanosecondsToMilliseconds, thresholdTicks * NanosecondsToMilliseconds, ToString(phase),
+            hitch.openZones.empty() ? "none" : hitch.openZones);
+    }
+
+    void HitchWatchdog::EndHitch(WatchedThread thread, uint64_t frameTicks)
+    {
+        Hitch& hitch = GetHeartbeat(thread).hitch;
+        DEBUG_LOG(LOG::WARNING, "Hitch: {} thread frame {} took {:.1f}ms.", ToString(thread), hitch.frameIndex, frameTicks * NanosecondsToMilliseconds);
+        AppendCsv(thread, hitch, frameTicks);
+        hitch = Hitch();
+    }
+
+    bool HitchWatchdog::OpenCsv(const std::string& filePath)
+    {
+        csvFilePath_ = "";
+
+        FileUtils::DeleteFileAtPath(filePath);
+        if (!FileUtils::CreateCsvFile(filePath, { "Thread", "Frame", "Phase", "DetectedMs", "FrameMs", "ThresholdMs", "OpenZones" }))
+        {
+            return false;
+        }
+
+        csvFilePath_ = filePath;
+        return true;
+    }
+
+    void HitchWatchdog::AppendCsv(WatchedThread thread, const Hitch& hitch, uint64_t frameTicks) const
+    {
+        if (csvFilePath_.empty())
+        {
+            return;
+        }
+
+        std::ofstream file(csvFilePath_, std::ios::app);
+        if (!file.is_open())
+        {
+            DEBUG_LOG(LOG::WARNING, "Failed to append hitch to {}", csvFilePath_);
+            return;
+        }
+
+        auto writer = CsvWriter<std::ofstream, true>::FromCsv(file);
+        writer << std::make_tuple(ToString(thread), hitch.frameIndex, ToString(hitch.phase), hitch.detectedTicks * NanosecondsToMilliseconds,
+            frameTicks * NanosecondsToMilliseconds, hitch.thresholdTicks * NanosecondsToMilliseconds, hitch.openZones);
+    }
+}
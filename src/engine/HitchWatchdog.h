@@ -0,0 +1,119 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_HITCHWATCHDOG_H
+#define AUX_HITCHWATCHDOG_H
+
+#include "engine/FrameStats.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace AuxEngine
+{
+    // Threads with a frame heartbeat of their own.
+    enum class WatchedThread : int
+    {
+        Main = 0,
+        Simulation = 1,     // Steps the app when the engine runs a simulation thread
+        MAX = 2
+    };
+
+    constexpr const char* ToString(WatchedThread thread)
+    {
+        switch (thread)
+        {
+        case WatchedThread::Main:       return "Main";
+        case WatchedThread::Simulation: return "Simulation";
+        default:                        return "Unknown";
+        }
+    }
+
+    /*
+    * Watches frame heartbeats from its own thread, so stalls are caught without a profiler attached.
+    * A frame still running past its thread's threshold is logged straight away with the engine phase and the profiler zones open at that moment,
+    * once the frame finally ends its total length is appended to the hitch CSV.
+    * The watched threads only write a few relaxed atomics per frame and phase.
+    */
+    class HitchWatchdog
+    {
+    public:
+        HitchWatchdog();
+        HitchWatchdog(const HitchWatchdog&) = delete;
+        HitchWatchdog(HitchWatchdog&&) = delete;
+        HitchWatchdog& operator=(const HitchWatchdog&) = delete;
+        HitchWatchdog& operator=(HitchWatchdog&&) = delete;
+        ~HitchWatchdog();
+
+        // Must be called from the main thread, which it starts watching. An empty csv file path only logs. Returns false if already running.
+        bool Start(uint64_t thresholdTicks, const std::string& csvFilePath);
+        void Stop();
+        bool IsRunning() const { return thread_.joinable(); }
+
+        // Starts and stops watching the calling thread, for threads that come and go while the watchdog runs.
+        void Watch(WatchedThread thread, uint64_t thresholdTicks);
+        void Unwatch(WatchedThread thread);
+
+        // Heartbeat, at the top of every frame of the given thread. Resets its phase to FramePhase::Update.
+        void BeginFrame(WatchedThread thread = WatchedThread::Main);
+        void SetPhase(FramePhase phase, WatchedThread thread = WatchedThread::Main);
+
+        // Time the current frame may take on top of the threshold, for intentional waits such as throttled frames.
+        void AllowFrameTime(uint64_t ticks, WatchedThread thread = WatchedThread::Main);
+
+        uint64_t GetThresholdTicks(WatchedThread thread = WatchedThread::Main) const;
+        uint64_t GetHitchCount() const { return hitchCount_.load(std::memory_order_relaxed); }
+
+    private:
+        // Start time of recent frames, so a hitch's length is still exact when several frames pass between two polls.
+        static constexpr size_t FrameHistorySize = 64;
+
+        struct Hitch
+        {
+            bool bIsActive = false;
+            uint64_t frameIndex = 0;
+            uint64_t frameStartTicks = 0;
+            uint64_t detectedTicks = 0;     // Frame time when the hitch was caught
+            uint64_t thresholdTicks = 0;
+            FramePhase phase = FramePhase::Update;
+            std::string openZones;
+        };
+
+        struct Heartbeat
+        {
+            std::array<std::atomic<uint64_t>, FrameHistorySize> frameStartTicks{};
+            std::atomic<uint64_t> frameIndex{ 0 };      // 0 until the first frame
+            std::atomic<uint64_t> allowanceTicks{ 0 };
+            std::atomic<int> phase{ static_cast<int>(FramePhase::Update) };
+            std::atomic<uint64_t> thresholdTicks{ 0 };  // 0 while the thread is not watched
+            std::atomic<uint32_t> threadId{ 0 };
+
+            // Watchdog thread only.
+            Hitch hitch;
+        };
+
+        std::array<Heartbeat, static_cast<size_t>(WatchedThread::MAX)> heartbeats_;
+        std::atomic<uint64_t> hitchCount_;
+        std::string csvFilePath_;
+
+        std::thread thread_;
+        std::mutex mutex_;
+        std::condition_variable wakeCondition_;
+        bool bStopRequested_;
+
+        Heartbeat& GetHeartbeat(WatchedThread thread) { return heartbeats_[static_cast<size_t>(thread)]; }
+        std::chrono::nanoseconds GetPollInterval() const;
+        void Run();
+        void Poll(WatchedThread thread);
+        void EndHitch(WatchedThread thread, uint64_t frameTicks);
+        bool OpenCsv(const std::string& filePath);
+        void AppendCsv(WatchedThread thread, const Hitch& hitch, uint64_t frameTicks) const;
+    };
+}
+
+#endif // !AUX_HITCHWATCHDOG_H
@@ -2,6 +2,10 @@
 
 
 #include "InputHandler.h"
+#include "FrameRecording.h"
+#include "Profiler.h"
+#include "events/EngineEvents.h"
+#include "events/EventBus.h"
 
 namespace  AuxEngine
 {
@@ -23,12 +27,22 @@ namespace  AuxEngine
 	{
 		trackedInputDevices_[inputDeviceId] = 1;
 		OnDeviceConnected(inputDeviceId, device);
+
+		if (eventBus_)
+		{
+			eventBus_->Post(InputDeviceChangedEvent(inputDeviceId, device, true));
+		}
 	}
 
 	void InputHandler::DeviceDisconnected(const int inputDeviceId, InputDevice device)
 	{
 		trackedInputDevices_[inputDeviceId] = 0;
 		OnDeviceDisconnected(inputDeviceId, device);
+
+		if (eventBus_)
+		{
+			eventBus_->Post(InputDeviceChangedEvent(inputDeviceId, device, false));
+		}
 	}
 
 	void InputHandler::BindKey(Key key, InputAction action, InputCallback inputCallback)
@@ -142,8 +156,80 @@ namespace  AuxEngine
 		}
 	}
 
+	void InputHandler::ReplayButtonInput(const unsigned int inputDeviceId, const InputEvent& inputEvent)
+	{
+		if (inputDeviceId < MAX_INPUT_DEVICE_COUNT)
+		{
+			OnReplayInput(inputDeviceId, inputEvent, false);
+			ProcessButtonInput(inputDeviceId, inputEvent);
+		}
+	}
+
+	void InputHandler::ReplayAxisInput(const unsigned int inputDeviceId, const InputEvent& inputEvent)
+	{
+		if (inputDeviceId < MAX_INPUT_DEVICE_COUNT)
+		{
+			OnReplayInput(inputDeviceId, inputEvent, true);
+			ProcessAxisInput(inputDeviceId, inputEvent);
+		}
+	}
+
+	void InputHandler::SetDeferredDispatch(bool bIsDeferred)
+	{
+		if (!bIsDeferred && IsDeferredDispatch())
+		{
+			// Nothing gathered while deferred may be lost.
+			DispatchDeferredInput();
+		}
+		bIsDeferredDispatch_.store(bIsDeferred, std::memory_order_release);
+	}
+
+	void InputHandler::DispatchDeferredInput()
+	{
+		AUX_PROFILE_SCOPE("InputHandler::DispatchDeferredInput");
+		{
+			std::lock_guard<std::mutex> lock(deferredInputMutex_);
+			dispatchInputs_.swap(publishedInputs_);
+			OnDispatchDeferredInput();
+		}
+
+		for (const DeferredInput& deferredInput : dispatchInputs_)
+		{
+			if (deferredInput.bIsAxis)
+			{
+				ApplyAxisInput(deferredInput.inputDeviceId, deferredInput.inputEvent);
+			}
+			else
+			{
+				ApplyButtonInput(deferredInput.inputDeviceId, deferredInput.inputEvent);
+			}
+		}
+		dispatchInputs_.clear();
+
+		RunInputBindings();
+	}
+
+	void InputHandler::PublishDeferredInput()
+	{
+		std::lock_guard<std::mutex> lock(deferredInputMutex_);
+		publishedInputs_.insert(publishedInputs_.end(), pendingInputs_.begin(), pendingInputs_.end());
+		pendingInputs_.clear();
+		OnPublishDeferredInput();
+	}
+
 	void InputHandler::ExecuteInputBindings()
 	{
+		if (IsDeferredDispatch())
+		{
+			PublishDeferredInput();
+			return;
+		}
+		RunInputBindings();
+	}
+
+	void InputHandler::RunInputBindings()
+	{
+		AUX_PROFILE_SCOPE("InputHandler::ExecuteInputBindings");
 		for (int i = 0; i < MAX_INPUT_DEVICE_COUNT; ++i)
 		{
 			for (const auto& [buttonId, inputCallbackBinding] : trackedInputCallbacks_[i])
@@ -181,6 +267,21 @@ namespace  AuxEngine
 			return;
 		}
 
+		if (recorder_)
+		{
+			recorder_->RecordInput(FrameRecordType::ButtonInput, inputDeviceId, inputEvent);
+		}
+
+		if (IsDeferredDispatch())
+		{
+			pendingInputs_.push_back(DeferredInput(inputDeviceId, inputEvent, false));
+			return;
+		}
+		ApplyButtonInput(inputDeviceId, inputEvent);
+	}
+
+	void InputHandler::ApplyButtonInput(const unsigned int inputDeviceId, const InputEvent& inputEvent)
+	{
 		InputInstance inputInstance = trackedInputs_[inputDeviceId][inputEvent.button];
 
 		// Updating Input Events if the incoming action is different than the last action.
@@ -189,6 +290,7 @@ namespace  AuxEngine
 			inputInstance.bIsConsumed = false;
 			inputInstance.prevInputEvent = inputInstance.currInputEvent;
 			inputInstance.currInputEvent = inputEvent;
+			lastInputTimestamp_.store(inputEvent.timestamp, std::memory_order_relaxed);
 		}
 
 		const InputAction prevAction = static_cast<InputAction>(inputInstance.prevInputEvent.action);
@@ -197,7 +299,7 @@ namespace  AuxEngine
 		if (prevAction == InputAction::Pressed
 			&& currAction == InputAction::Released)
 		{
-			const int TimeBetweenCurrentAndPreviousInput = inputInstance.currInputEvent.timestamp - inputInstance.prevInputEvent.timestamp;
+			const uint64_t TimeBetweenCurrentAndPreviousInput = inputInstance.currInputEvent.timestamp - inputInstance.prevInputEvent.timestamp;
 			if ((TimeBetweenCurrentAndPreviousInput) <= CLICK_TIME)
 			{
 				inputInstance.cachedAction = InputAction::Clicked;
@@ -222,6 +324,21 @@ namespace  AuxEngine
 			return;
 		}
 
+		if (recorder_)
+		{
+			recorder_->RecordInput(FrameRecordType::AxisInput, inputDeviceId, inputEvent);
+		}
+
+		if (IsDeferredDispatch())
+		{
+			pendingInputs_.push_back(DeferredInput(inputDeviceId, inputEvent, true));
+			return;
+		}
+		ApplyAxisInput(inputDeviceId, inputEvent);
+	}
+
+	void InputHandler::ApplyAxisInput(const unsigned int inputDeviceId, const InputEvent& inputEvent)
+	{
 		InputInstance inputInstance = trackedAxes_[inputDeviceId][inputEvent.button];
 
 		const bool bIsTriggerAxis = IsTriggerAxis(static_cast<GamepadAxis>(inputEvent.button));
@@ -246,6 +363,7 @@ namespace  AuxEngine
 			inputInstance.currInputEvent = inputEvent;
 
 			inputInstance.cachedAxisAction = AxisAction::Tilted;
+			lastInputTimestamp_.store(inputEvent.timestamp, std::memory_order_relaxed);
 
 			const InputAction prevAction = static_cast<InputAction>(inputInstance.prevInputEvent.action);
 			const InputAction currAction = static_cast<InputAction>(inputInstance.currInputEvent.action);
@@ -6,10 +6,16 @@
 #include <unordered_map>
 #include <functional>
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 
 namespace  AuxEngine
 {
     class WindowHandler;
+    class FrameRecorder;
+    class EventBus;
 
     enum class GamepadId : int
     {
@@ -239,7 +245,7 @@ namespace  AuxEngine
         int button = -1;  // Can be a Key, Mouse Button, or Gamepad Button. Also used to represent Axis Id, when input is coming from an Axis.
         int action = 0;  
         float value = 0.0f; // Used store the axis value from -1.0f to 1.0f inclusive
-        unsigned int timestamp = 0;
+        uint64_t timestamp = 0; // Nanoseconds, same timebase as EngineClock
     };
 
     struct InputInstance
@@ -255,7 +261,7 @@ namespace  AuxEngine
 
         bool bIsConsumed = false;
 
-        unsigned int AccumulatedHoldTime = 0;
+        uint64_t AccumulatedHoldTime = 0;
     };
 
     enum class InputDevice
@@ -268,8 +274,8 @@ namespace  AuxEngine
 
     class InputHandler
     {
-        // Time window between press and release state of an input to be considered clicked.
-        static constexpr unsigned int CLICK_TIME{ 350 };
+        // Time window between press and release state of an input to be considered clicked. 350ms, in nanoseconds.
+        static constexpr uint64_t CLICK_TIME{ 350'000'000 };
 
         // Max Number of Gamepads supported by this input handler.
         static constexpr unsigned int MAX_GAMEPAD_COUNT{ 16 };
@@ -326,6 +332,9 @@ namespace  AuxEngine
         int GetKeyboardDeviceId() const { return KEYBOARD_INDEX; }
         int GetMouseDeviceId() const { return MOUSE_INDEX; }
 
+        // Timestamp of the last button change or live axis, in EngineClock nanoseconds. 0 until the first input arrives.
+        uint64_t GetLastInputTimestamp() const { return lastInputTimestamp_.load(std::memory_order_relaxed); }
+
     protected:
         void DeviceConnected(const int inputDeviceId, InputDevice device);
         void DeviceDisconnected(const int inputDeviceId, InputDevice device);
@@ -333,6 +342,9 @@ namespace  AuxEngine
         virtual void OnDeviceConnected(const int inputDeviceId, InputDevice device) = 0;
         virtual void OnDeviceDisconnected(const int inputDeviceId, InputDevice device) = 0;
 
+        // Called with every replayed event before it is processed, so a handler without a device can keep its polled state in step.
+        virtual void OnReplayInput(const unsigned int inputDeviceId, const InputEvent& inputEvent, bool bIsAxis) {}
+
     public:
         // TODO: Find out how I can remove the need to add the placeholder params on std::bind(...) for input and axis bindings.
 
@@ -350,6 +362,24 @@ namespace  AuxEngine
         void ClearGamepadButtonBinding(GamepadId gamepadId, GamepadButton button);
         void ClearGamepadAxisBinding(GamepadId gamepadId, GamepadAxis axis);
 
+        // While a recorder is set, every input event reaching the handler is written to it.
+        void SetRecorder(FrameRecorder* recorder) { recorder_ = recorder; }
+
+        // Device connections are posted here once set.
+        void SetEventBus(EventBus* eventBus) { eventBus_ = eventBus; }
+
+        // Feeds a recorded input event back in, as if it came from the device.
+        void ReplayButtonInput(const unsigned int inputDeviceId, const InputEvent& inputEvent);
+        void ReplayAxisInput(const unsigned int inputDeviceId, const InputEvent& inputEvent);
+
+        // While deferred, Update only gathers input and publishes it once per call, instead of applying it and running the bindings.
+        // DispatchDeferredInput then applies everything published so far and runs the bindings on the calling thread,
+        // which lets a simulation thread consume the input the main thread pumps. Bindings are only safe to change from that thread.
+        // Polls such as IsKeyDown then answer from the state published along with the input, not from the device.
+        void SetDeferredDispatch(bool bIsDeferred);
+        bool IsDeferredDispatch() const { return bIsDeferredDispatch_.load(std::memory_order_acquire); }
+        void DispatchDeferredInput();
+
         // TODO: Add support for unique input binding. At the moment a single function can be bound to inputs. Requiring clearing of all bindings at input if you would like to bind something else to the input.
 
     protected:
@@ -361,6 +391,11 @@ namespace  AuxEngine
 
         void ExecuteInputBindings();
 
+        // Both run under the deferred input lock, so a handler can hand its polled state over together with the input.
+        // Publish on the thread calling Update, once per call. Dispatch on the thread calling DispatchDeferredInput.
+        virtual void OnPublishDeferredInput() {}
+        virtual void OnDispatchDeferredInput() {}
+
     private:
         // Value of 1 at the given device index, means device is connected. Value of 0 means the device at the given index is not connected.
         std::array<int, MAX_INPUT_DEVICE_COUNT> trackedInputDevices_ = {};
@@ -370,8 +405,31 @@ namespace  AuxEngine
         std::unordered_map<int /*Device Input Id*/, TrackedInputMap> trackedAxes_;
         std::unordered_map<int /*Device Input Id*/, AxisCallbackMap> trackedAxisCallbacks_;
 
+        FrameRecorder* recorder_ = nullptr;
+        EventBus* eventBus_ = nullptr;
+        std::atomic<uint64_t> lastInputTimestamp_ = 0;
+
+        struct DeferredInput
+        {
+            unsigned int inputDeviceId = 0;
+            InputEvent inputEvent;
+            bool bIsAxis = false;
+        };
+
+        // Double buffered hand over: Update fills the pending buffer without locking and appends it to the published one,
+        // DispatchDeferredInput swaps the published buffer out under the same lock.
+        std::atomic<bool> bIsDeferredDispatch_ = false;
+        std::vector<DeferredInput> pendingInputs_;
+        std::vector<DeferredInput> publishedInputs_;
+        std::vector<DeferredInput> dispatchInputs_;
+        std::mutex deferredInputMutex_;
+
         void ProcessButtonInput(const unsigned int inputDeviceId, const InputEvent& inputEvent);
         void ProcessAxisInput(const unsigned int inputDeviceId, const InputEvent& inputEvent);
+        void ApplyButtonInput(const unsigned int inputDeviceId, const InputEvent& inputEvent);
+        void ApplyAxisInput(const unsigned int inputDeviceId, const InputEvent& inputEvent);
+        void PublishDeferredInput();
+        void RunInputBindings();
 
         bool IsTriggerAxis(GamepadAxis axis) const;
     };
@@ -0,0 +1,374 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/Profiler.h"
+
+#include "engine/SpscQueue.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace AuxEngine
+{
+    namespace
+    {
+        // Zones a thread can finish between two flushes before new ones are dropped.
+        constexpr size_t ThreadZoneCapacity = 16384;
+
+        struct ThreadZones
+        {
+            SpscQueue<ProfileZone, ThreadZoneCapacity> zones;
+            uint32_t threadId = 0;
+            bool bIsRetired = false;    // Its thread exited, the ring goes to the next new thread once drained
+
+            // Written by the owning thread only, read by GetOpenZones from any thread.
+            std::array<std::atomic<const char*>, Profiler::MaxOpenZoneDepth> openZones{};
+            std::atomic<uint32_t> openZoneDepth{ 0 };
+        };
+
+        struct CollectedZone
+        {
+            ProfileZone zone;
+            uint32_t threadId = 0;
+        };
+
+        struct ProfilerState
+        {
+            std::atomic<bool> bIsCapturing{ false };
+            std::atomic<bool> bIsTrackingOpenZones{ false };
+            std::atomic<uint64_t> droppedZones{ 0 };
+
+            std::mutex mutex;
+            // A ring outlives its thread so zones recorded just before the thread exits are still flushed, then it is handed to the next new thread.
+            // Only as many rings as threads alive at once are ever allocated.
+            std::vector<std::unique_ptr<ThreadZones>> threads;
+            // Indexed by thread id, ids are never reused so collected zones keep pointing at the right name.
+            // A thread gets its id and name straight away, its ring only once it records or tracks a zone.
+            std::vector<std::string> threadNames;
+            std::vector<CollectedZone> zones;
+            size_t maxZones = 1000000;
+        };
+
+        ProfilerState& GetState()
+        {
+            static ProfilerState state;
+            return state;
+        }
+
+        // Caller holds the state mutex.
+        void FlushThreadZones(ProfilerState& state, ThreadZones& threadZones, uint64_t& outDropped)
+        {
+            ProfileZone zone;
+            while (threadZones.zones.Pop(zone))
+            {
+                if (state.zones.size() < state.maxZones)
+                {
+                    state.zones.push_back(CollectedZone(zone, threadZones.threadId));
+                }
+                else
+                {
+                    ++outDropped;
+                }
+            }
+        }
+
+        constexpr uint32_t InvalidThreadId = std::numeric_limits<uint32_t>::max();
+
+        thread_local uint32_t tl_threadId = InvalidThreadId;
+        thread_local ThreadZones* tl_threadZones = nullptr;
+
+        // Caller holds the state mutex.
+        uint32_t GetOrAssignThreadId(ProfilerState& state)
+        {
+            if (tl_threadId == InvalidThreadId)
+            {
+                tl_threadId = static_cast<uint32_t>(state.threadNames.size());
+                state.threadNames.push_back(std::format("Thread {}", tl_threadId));
+            }
+            return tl_threadId;
+        }
+
+        // Retires the thread's ring when the thread exits.
+        struct ThreadZonesOwner
+        {
+            ~ThreadZonesOwner()
+            {
+                if (!tl_threadZones)
+                {
+                    return;
+                }
+
+                ProfilerState& state = GetState();
+                std::lock_guard<std::mutex> lock(state.mutex);
+                tl_threadZones->openZoneDepth.store(0, std::memory_order_relaxed);
+                tl_threadZones->bIsRetired = true;
+                tl_threadZones = nullptr;
+            }
+        };
+
+        thread_local ThreadZonesOwner tl_threadZonesOwner;
+
+        ThreadZones& GetThreadZones()
+        {
+            if (!tl_threadZones)
+            {
+                ProfilerState& state = GetState();
+                std::lock_guard<std::mutex> lock(state.mutex);
+
+                ThreadZones* threadZones = nullptr;
+                for (const std::unique_ptr<ThreadZones>& retired : state.threads)
+                {
+                    if (retired->bIsRetired)
+                    {
+                        threadZones = retired.get();
+                        break;
+                    }
+                }
+
+                if (threadZones)
+                {
+                    // Whatever the exited thread left behind is collected before the ring changes hands.
+                    uint64_t dropped = 0;
+                    FlushThreadZones(state, *threadZones, dropped);
+                    state.droppedZones.fetch_add(dropped, std::memory_order_relaxed);
+                    threadZones->bIsRetired = false;
+                }
+                else
+                {
+                    threadZones = state.threads.emplace_back(std::make_unique<ThreadZones>()).get();
+                }
+
+                threadZones->threadId = GetOrAssignThreadId(state);
+                tl_threadZones = threadZones;
+
+                // Referencing the owner constructs it on this thread, so its destructor runs when the thread exits.
+                static_cast<void>(&tl_threadZonesOwner);
+            }
+            return *tl_threadZones;
+        }
+
+        void WriteEscaped(std::ofstream& file, const char* text)
+        {
+            for (const char* c = text; c && *c; ++c)
+            {
+                switch (*c)
+                {
+                case '"':   file << "\\\""; break;
+                case '\\':  file << "\\\\"; break;
+                case '\n':  file << "\\n"; break;
+                case '\t':  file << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(*c) < 0x20)
+                    {
+                        file << std::format("\\u{:04x}", static_cast<int>(*c));
+                    }
+                    else
+                    {
+                        file << *c;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    void Profiler::SetCapturing(bool bIsCapturing)
+    {
+        GetState().bIsCapturing.store(bIsCapturing, std::memory_order_relaxed);
+    }
+
+    bool Profiler::IsCapturing()
+    {
+        return GetState().bIsCapturing.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::SetMaxZones(size_t maxZones)
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.maxZones = maxZones;
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.threadNames[GetOrAssignThreadId(state)] = name;
+    }
+
+    void Profiler::RecordZone(const char* name, uint64_t beginTicks, uint64_t endTicks)
+    {
+        if (!GetThreadZones().zones.Push(ProfileZone(name, beginTicks, endTicks)))
+        {
+            GetState().droppedZones.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Profiler::Flush()
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        uint64_t dropped = 0;
+        for (const std::unique_ptr<ThreadZones>& threadZones : state.threads)
+        {
+            FlushThreadZones(state, *threadZones, dropped);
+        }
+
+        if (dropped > 0)
+        {
+            state.droppedZones.fetch_add(dropped, std::memory_order_relaxed);
+        }
+    }
+
+    size_t Profiler::GetZoneCount()
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.zones.size();
+    }
+
+    uint64_t Profiler::GetDroppedZoneCount()
+    {
+        return GetState().droppedZones.load(std::memory_order_relaxed);
+    }
+
+    bool Profiler::WriteChromeTrace(const std::string& filePath)
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        std::ofstream file(filePath, std::ios::out | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+
+        // Trace timestamps are microseconds, offset from the first zone so they stay readable.
+        uint64_t baseTicks = std::numeric_limits<uint64_t>::max();
+        for (const CollectedZone& collected : state.zones)
+        {
+            baseTicks = std::min(baseTicks, collected.zone.beginTicks);
+        }
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        bool bIsFirst = true;
+        for (uint32_t threadId = 0; threadId < state.threadNames.size(); ++threadId)
+        {
+            file << (bIsFirst ? "\n" : ",\n");
+            file << std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"", threadId);
+            WriteEscaped(file, state.threadNames[threadId].c_str());
+            file << "\"}}";
+            bIsFirst = false;
+        }
+
+        for (const CollectedZone& collected : state.zones)
+        {
+            file << (bIsFirst ? "\n" : ",\n");
+            file << "{\"name\":\"";
+            WriteEscaped(file, collected.zone.name);
+            file << std::format("\",\"cat\":\"AuxEngine\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                collected.threadId,
+                static_cast<double>(collected.zone.beginTicks - baseTicks) / MICROSECONDS_TO_NANOSECONDS,
+                static_cast<double>(collected.zone.endTicks - collected.zone.beginTicks) / MICROSECONDS_TO_NANOSECONDS);
+            bIsFirst = false;
+        }
+
+        file << "\n]}\n";
+        return static_cast<bool>(file);
+    }
+
+    void Profiler::Clear()
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.zones.clear();
+        state.droppedZones.store(0, std::memory_order_relaxed);
+    }
+
+    void Profiler::SetTrackingOpenZones(bool bIsTracking)
+    {
+        GetState().bIsTrackingOpenZones.store(bIsTracking, std::memory_order_relaxed);
+    }
+
+    bool Profiler::IsTrackingOpenZones()
+    {
+        return GetState().bIsTrackingOpenZones.load(std::memory_order_relaxed);
+    }
+
+    void Profiler::PushOpenZone(const char* name)
+    {
+        ThreadZones& threadZones = GetThreadZones();
+        const uint32_t depth = threadZones.openZoneDepth.load(std::memory_order_relaxed);
+        if (depth < MaxOpenZoneDepth)
+        {
+            threadZones.openZones[depth].store(name, std::memory_order_relaxed);
+        }
+        threadZones.openZoneDepth.store(depth + 1, std::memory_order_release);
+    }
+
+    void Profiler::PopOpenZone()
+    {
+        // Without a ring no zone was ever pushed.
+        if (!tl_threadZones)
+        {
+            return;
+        }
+
+        const uint32_t depth = tl_threadZones->openZoneDepth.load(std::memory_order_relaxed);
+        if (depth > 0)
+        {
+            tl_threadZones->openZoneDepth.store(depth - 1, std::memory_order_release);
+        }
+    }
+
+    uint32_t Profiler::GetCurrentThreadId()
+    {
+        if (tl_threadId == InvalidThreadId)
+        {
+            ProfilerState& state = GetState();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            GetOrAssignThreadId(state);
+        }
+        return tl_threadId;
+    }
+
+    std::string Profiler::GetOpenZones(uint32_t threadId)
+    {
+        ProfilerState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        const auto it = std::find_if(state.threads.begin(), state.threads.end(),
+            [threadId](const std::unique_ptr<ThreadZones>& threadZones) { return !threadZones->bIsRetired && threadZones->threadId == threadId; });
+        if (it == state.threads.end())
+        {
+            return "";
+        }
+
+        const ThreadZones& threadZones = **it;
+        const uint32_t depth = threadZones.openZoneDepth.load(std::memory_order_acquire);
+
+        std::string openZones;
+        for (uint32_t i = 0; i < std::min<uint32_t>(depth, MaxOpenZoneDepth); ++i)
+        {
+            if (i > 0)
+            {
+                openZones += " > ";
+            }
+            const char* name = threadZones.openZones[i].load(std::memory_order_relaxed);
+            openZones += name ? name : "?";
+        }
+
+        if (depth > MaxOpenZoneDepth)
+        {
+            openZones += std::format(" > ({} more)", depth - MaxOpenZoneDepth);
+        }
+        return openZones;
+    }
+}
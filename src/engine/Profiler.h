@@ -0,0 +1,130 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_PROFILER_H
+#define AUX_PROFILER_H
+
+#include "engine/EngineClock.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#define AUX_PROFILE_CONCAT_INNER(a, b) a##b
+#define AUX_PROFILE_CONCAT(a, b) AUX_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(AUX_PROFILER_ENABLED)
+/* Records the enclosing scope as a named zone while the profiler is capturing. Name must be a string literal or otherwise outlive the capture. */
+#define AUX_PROFILE_SCOPE(name) AuxEngine::ProfileScope AUX_PROFILE_CONCAT(auxProfileScope_, __LINE__)(name)
+/* Names the calling thread in exported traces. */
+#define AUX_PROFILE_THREAD(name) AuxEngine::Profiler::SetThreadName(name)
+#else
+#define AUX_PROFILE_SCOPE(name) ((void)0)
+#define AUX_PROFILE_THREAD(name) ((void)0)
+#endif
+
+namespace AuxEngine
+{
+    struct ProfileZone
+    {
+        const char* name = nullptr;
+        uint64_t beginTicks = 0;
+        uint64_t endTicks = 0;
+    };
+
+    /*
+    * Scoped zone tracer. Each thread writes finished zones into its own lock-free ring, the main thread
+    * collects them once per frame with Flush and can export everything as Chrome trace event JSON,
+    * which loads in chrome://tracing and Perfetto.
+    * Zones are only recorded while capturing, otherwise a zone costs one relaxed load.
+    */
+    class Profiler
+    {
+    public:
+        Profiler() = delete;	// Static class, no constructor needed
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+        Profiler(Profiler&&) = delete;
+        Profiler& operator=(Profiler&&) = delete;
+
+        static void SetCapturing(bool bIsCapturing);
+        static bool IsCapturing();
+
+        // Collected zones past this count are dropped, so a long capture cannot grow without bound.
+        static void SetMaxZones(size_t maxZones);
+
+        static void SetThreadName(const std::string& name);
+
+        // Called by ProfileScope. Safe from any thread.
+        static void RecordZone(const char* name, uint64_t beginTicks, uint64_t endTicks);
+
+        // Main thread only. Moves finished zones from every thread's ring into the capture.
+        static void Flush();
+
+        static size_t GetZoneCount();
+        static uint64_t GetDroppedZoneCount();
+
+        // Writes the capture as Chrome trace event JSON. Returns false if the file could not be written.
+        static bool WriteChromeTrace(const std::string& filePath);
+
+        // Drops the capture and the dropped count, thread rings and names are kept.
+        static void Clear();
+
+        // Zones deeper than this are counted by the open zone stack but not named.
+        static constexpr size_t MaxOpenZoneDepth = 32;
+
+        // While tracking, every zone also keeps its thread's stack of open zones current, capturing or not,
+        // so a watchdog can tell where a stalled thread is. Costs two relaxed atomic stores per zone.
+        static void SetTrackingOpenZones(bool bIsTracking);
+        static bool IsTrackingOpenZones();
+
+        // Called by ProfileScope.
+        static void PushOpenZone(const char* name);
+        static void PopOpenZone();
+
+        // Id of the calling thread in traces and GetOpenZones.
+        static uint32_t GetCurrentThreadId();
+
+        // Zones the thread has open, outermost first, joined with " > ". Safe from any thread, the stack may have moved on by the time it returns.
+        static std::string GetOpenZones(uint32_t threadId);
+    };
+
+    class ProfileScope
+    {
+    public:
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+        ProfileScope(ProfileScope&&) = delete;
+        ProfileScope& operator=(ProfileScope&&) = delete;
+
+        explicit ProfileScope(const char* name) :
+            name_(name),
+            beginTicks_(Profiler::IsCapturing() ? EngineClock::GetCurrentTimeInNanoSeconds() : 0),
+            bIsTracked_(Profiler::IsTrackingOpenZones())
+        {
+            if (bIsTracked_)
+            {
+                Profiler::PushOpenZone(name_);
+            }
+        }
+
+        ~ProfileScope()
+        {
+            if (bIsTracked_)
+            {
+                Profiler::PopOpenZone();
+            }
+
+            if (beginTicks_ != 0)
+            {
+                Profiler::RecordZone(name_, beginTicks_, EngineClock::GetCurrentTimeInNanoSeconds());
+            }
+        }
+
+    private:
+        const char* name_;
+        uint64_t beginTicks_;
+        bool bIsTracked_;
+    };
+}
+
+#endif // !AUX_PROFILER_H
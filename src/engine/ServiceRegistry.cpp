@@ -0,0 +1,39 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/ServiceRegistry.h"
+
+namespace AuxEngine
+{
+    static thread_local ServiceRegistry* tl_currentServices = nullptr;
+
+    ServiceRegistry::ServiceRegistry()
+    {
+        Clear();
+    }
+
+    ServiceRegistry::~ServiceRegistry()
+    {
+        if (tl_currentServices == this)
+        {
+            tl_currentServices = nullptr;
+        }
+    }
+
+    void ServiceRegistry::Clear()
+    {
+        for (std::atomic<void*>& service : services_)
+        {
+            service.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    ServiceRegistry* ServiceRegistry::GetCurrent()
+    {
+        return tl_currentServices;
+    }
+
+    void ServiceRegistry::SetCurrent(ServiceRegistry* registry)
+    {
+        tl_currentServices = registry;
+    }
+}
@@ -0,0 +1,109 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_SERVICEREGISTRY_H
+#define AUX_SERVICEREGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace AuxEngine
+{
+    class Engine;
+    class EngineConfig;
+    class EngineClock;
+    class FramePacer;
+    class FrameStatsRecorder;
+    class WindowHandler;
+    class InputHandler;
+    class JobSystem;
+    class TaskGraph;
+    class SystemScheduler;
+    class DeferredWorkQueue;
+    class TimerService;
+    class FrameArena;
+    class EventBus;
+    class CoroutineScheduler;
+
+    template<typename... Services>
+    struct ServiceList
+    {
+        static constexpr size_t Count = sizeof...(Services);
+
+        // Position of T in the list, Count if it is not listed.
+        template<typename T>
+        static constexpr size_t IndexOf()
+        {
+            constexpr bool matches[] = { std::is_same_v<T, Services>... };
+            for (size_t i = 0; i < Count; ++i)
+            {
+                if (matches[i])
+                {
+                    return i;
+                }
+            }
+            return Count;
+        }
+    };
+
+    // Every type an engine can register. The position in this list is the service's id.
+    using EngineServices = ServiceList<Engine, EngineConfig, EngineClock, FramePacer, FrameStatsRecorder, WindowHandler, InputHandler,
+        JobSystem, TaskGraph, SystemScheduler, DeferredWorkQueue, TimerService, FrameArena, EventBus, CoroutineScheduler>;
+
+    /*
+    * Per engine table of its services, indexed by an id fixed at compile time, so a lookup is a single load.
+    * Registration happens on the main thread while the engine starts or shuts down, lookups are safe from any thread.
+    * Each engine owns its own registry, so several engines can live in one process. Code without an engine at hand
+    * reaches the one driving the calling thread through GetCurrent.
+    */
+    class ServiceRegistry
+    {
+    public:
+        ServiceRegistry(const ServiceRegistry&) = delete;
+        ServiceRegistry(ServiceRegistry&&) = delete;
+        ServiceRegistry& operator=(const ServiceRegistry&) = delete;
+        ServiceRegistry& operator=(ServiceRegistry&&) = delete;
+
+        ServiceRegistry();
+        ~ServiceRegistry();
+
+        template<typename T>
+        static constexpr size_t GetServiceId()
+        {
+            constexpr size_t id = EngineServices::IndexOf<T>();
+            static_assert(id < EngineServices::Count, "Type is not listed in EngineServices.");
+            return id;
+        }
+
+        template<typename T>
+        void Register(T* service)
+        {
+            services_[GetServiceId<T>()].store(service, std::memory_order_release);
+        }
+
+        template<typename T>
+        void Unregister()
+        {
+            services_[GetServiceId<T>()].store(nullptr, std::memory_order_release);
+        }
+
+        // nullptr if the service is not registered.
+        template<typename T>
+        T* Get() const
+        {
+            return static_cast<T*>(services_[GetServiceId<T>()].load(std::memory_order_acquire));
+        }
+
+        void Clear();
+
+        // Registry of the engine driving the calling thread, set by the engine while it starts and runs frames. nullptr on other threads.
+        static ServiceRegistry* GetCurrent();
+        static void SetCurrent(ServiceRegistry* registry);
+
+    private:
+        std::array<std::atomic<void*>, EngineServices::Count> services_;
+    };
+}
+
+#endif // !AUX_SERVICEREGISTRY_H
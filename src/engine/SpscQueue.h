@@ -0,0 +1,65 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_SPSCQUEUE_H
+#define AUX_SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace AuxEngine
+{
+    /*
+    * Fixed capacity lock-free queue for exactly one producer thread and one consumer thread.
+    * Capacity must be a power of two.
+    */
+    template<typename T, size_t Capacity>
+    class SpscQueue
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two.");
+        static constexpr size_t Mask = Capacity - 1;
+
+    public:
+        SpscQueue() = default;
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue(SpscQueue&&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+        SpscQueue& operator=(SpscQueue&&) = delete;
+        ~SpscQueue() = default;
+
+        // Producer only. Returns false when the queue is full.
+        bool Push(const T& item)
+        {
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail - head_.load(std::memory_order_acquire) >= Capacity)
+            {
+                return false;
+            }
+
+            items_[tail & Mask] = item;
+            tail_.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer only. Returns false when the queue is empty.
+        bool Pop(T& outItem)
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            if (head == tail_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            outItem = items_[head & Mask];
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        alignas(64) std::atomic<size_t> head_{ 0 };
+        alignas(64) std::atomic<size_t> tail_{ 0 };
+        std::array<T, Capacity> items_;
+    };
+}
+
+#endif // !AUX_SPSCQUEUE_H
@@ -0,0 +1,279 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/SystemScheduler.h"
+
+#include "engine/DebugLog.h"
+#include "engine/EngineClock.h"
+#include "engine/jobs/JobSystem.h"
+
+#include <algorithm>
+
+namespace AuxEngine
+{
+    static bool Contains(const std::vector<std::string>& names, const std::string& name)
+    {
+        return std::find(names.begin(), names.end(), name) != names.end();
+    }
+
+    static bool Intersects(const std::vector<TaskResourceId>& first, const std::vector<TaskResourceId>& second)
+    {
+        for (const TaskResourceId resource : first)
+        {
+            if (std::find(second.begin(), second.end(), resource) != second.end())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool SystemScheduler::AddSystem(const std::string& name, SystemPhase phase, SystemFunction function, void* context, const SystemOptions& options)
+    {
+        if (!function || phase == SystemPhase::MAX)
+        {
+            DEBUG_LOG(LOG::ERRORLOG, "Failed to add system {}. Invalid function or phase!", name);
+            return false;
+        }
+
+        if (HasSystem(name))
+        {
+            DEBUG_LOG(LOG::WARNING, "System {} is already registered.", name);
+            return false;
+        }
+
+        systems_.push_back(System{ name, phase, function, context, options });
+        bIsCompiled_ = false;
+        return true;
+    }
+
+    bool SystemScheduler::RemoveSystem(const std::string& name)
+    {
+        const auto it = std::find_if(systems_.begin(), systems_.end(), [&name](const System& system) { return system.name == name; });
+        if (it == systems_.end())
+        {
+            return false;
+        }
+
+        systems_.erase(it);
+        bIsCompiled_ = false;
+        return true;
+    }
+
+    bool SystemScheduler::HasSystem(const std::string& name) const
+    {
+        return std::any_of(systems_.begin(), systems_.end(), [&name](const System& system) { return system.name == name; });
+    }
+
+    void SystemScheduler::Clear()
+    {
+        systems_.clear();
+        bIsCompiled_ = false;
+    }
+
+    bool SystemScheduler::Compile()
+    {
+        bool bSucceeded = true;
+        for (int phase = 0; phase < static_cast<int>(SystemPhase::MAX); ++phase)
+        {
+            bSucceeded &= CompilePhase(static_cast<SystemPhase>(phase));
+        }
+
+        // Marked compiled even on failure, the broken phase stays empty until the systems change again.
+        bIsCompiled_ = true;
+        return bSucceeded;
+    }
+
+    bool SystemScheduler::CompilePhase(SystemPhase phase)
+    {
+        CompiledPhase& compiled = phases_[static_cast<size_t>(phase)];
+        compiled = CompiledPhase();
+
+        std::vector<size_t> members;
+        for (size_t i = 0; i < systems_.size(); ++i)
+        {
+            if (systems_[i].phase == phase)
+            {
+                members.push_back(i);
+            }
+        }
+
+        const size_t count = members.size();
+        if (count == 0)
+        {
+            return true;
+        }
+
+        for (const size_t member : members)
+        {
+            const System& system = systems_[member];
+            for (const std::string& other : system.options.runAfter)
+            {
+                if (std::none_of(members.begin(), members.end(), [&](size_t i) { return systems_[i].name == other; }))
+                {
+                    DEBUG_LOG(LOG::WARNING, "System {} runs after unknown system {} in phase {}.", system.name, other, ToString(phase));
+                }
+            }
+            for (const std::string& other : system.options.runBefore)
+            {
+                if (std::none_of(members.begin(), members.end(), [&](size_t i) { return systems_[i].name == other; }))
+                {
+                    DEBUG_LOG(LOG::WARNING, "System {} runs before unknown system {} in phase {}.", system.name, other, ToString(phase));
+                }
+            }
+        }
+
+        // Kahn's algorithm, always picking the earliest registered ready system so unconstrained systems keep registration order.
+        std::vector<std::vector<size_t>> successors(count);
+        std::vector<int> inDegree(count, 0);
+        for (size_t a = 0; a < count; ++a)
+        {
+            const System& first = systems_[members[a]];
+            for (size_t b = 0; b < count; ++b)
+            {
+                const System& second = systems_[members[b]];
+                if (a != b && (Contains(second.options.runAfter, first.name) || Contains(first.options.runBefore, second.name)))
+                {
+                    successors[a].push_back(b);
+                    ++inDegree[b];
+                }
+            }
+        }
+
+        std::vector<size_t> sorted;
+        sorted.reserve(count);
+        std::vector<bool> bEmitted(count, false);
+        while (sorted.size() < count)
+        {
+            size_t next = count;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!bEmitted[i] && inDegree[i] == 0)
+                {
+                    next = i;
+                    break;
+                }
+            }
+
+            if (next == count)
+            {
+                DEBUG_LOG(LOG::ERRORLOG, "Failed to compile systems in phase {}. Ordering constraints contain a cycle!", ToString(phase));
+                return false;
+            }
+
+            bEmitted[next] = true;
+            sorted.push_back(members[next]);
+            for (const size_t successor : successors[next])
+            {
+                --inDegree[successor];
+            }
+        }
+
+        // Greedily pack consecutive systems into batches that can run at the same time.
+        size_t batchStart = 0;
+        for (size_t i = 0; i < sorted.size(); ++i)
+        {
+            const System& system = systems_[sorted[i]];
+
+            bool bStartsBatch = (i == 0);
+            for (size_t j = batchStart; j < i && !bStartsBatch; ++j)
+            {
+                const System& batched = systems_[sorted[j]];
+                bStartsBatch = Conflicts(batched, system) || IsOrdered(batched, system);
+            }
+
+            if (bStartsBatch)
+            {
+                batchStart = i;
+                compiled.batchOffsets.push_back(i);
+            }
+
+            compiled.functions.push_back(system.function);
+            compiled.contexts.push_back(system.context);
+            compiled.ticks.push_back(0);
+            compiled.systemIndices.push_back(sorted[i]);
+        }
+        compiled.batchOffsets.push_back(sorted.size());
+
+        return true;
+    }
+
+    void SystemScheduler::RunPhase(SystemPhase phase, float deltaTime, JobSystem* jobSystem)
+    {
+        if (!bIsCompiled_)
+        {
+            Compile();
+        }
+
+        CompiledPhase& compiled = phases_[static_cast<size_t>(phase)];
+
+        const auto runSystem = [&compiled, deltaTime](size_t index)
+            {
+                const uint64_t start = EngineClock::GetCurrentTimeInNanoSeconds();
+                compiled.functions[index](compiled.contexts[index], deltaTime);
+                compiled.ticks[index] = EngineClock::GetCurrentTimeInNanoSeconds() - start;
+            };
+
+        for (size_t batch = 0; batch + 1 < compiled.batchOffsets.size(); ++batch)
+        {
+            const size_t begin = compiled.batchOffsets[batch];
+            const size_t end = compiled.batchOffsets[batch + 1];
+
+            if (end - begin == 1 || !jobSystem)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    runSystem(i);
+                }
+            }
+            else
+            {
+                jobSystem->ParallelFor(end - begin, 1, [&runSystem, begin](size_t first, size_t last)
+                    {
+                        for (size_t i = first; i < last; ++i)
+                        {
+                            runSystem(begin + i);
+                        }
+                    });
+            }
+        }
+    }
+
+    std::vector<SystemTiming> SystemScheduler::GetSystemTimings() const
+    {
+        std::vector<SystemTiming> timings;
+        if (!bIsCompiled_)
+        {
+            return timings;
+        }
+
+        for (const CompiledPhase& compiled : phases_)
+        {
+            for (size_t i = 0; i < compiled.systemIndices.size(); ++i)
+            {
+                const System& system = systems_[compiled.systemIndices[i]];
+                timings.push_back(SystemTiming{ system.name, system.phase, compiled.ticks[i] });
+            }
+        }
+        return timings;
+    }
+
+    bool SystemScheduler::Conflicts(const System& first, const System& second)
+    {
+        const bool bFirstDeclares = !first.options.reads.empty() || !first.options.writes.empty();
+        const bool bSecondDeclares = !second.options.reads.empty() || !second.options.writes.empty();
+        if (!bFirstDeclares || !bSecondDeclares)
+        {
+            return true;
+        }
+
+        return Intersects(first.options.writes, second.options.reads)
+            || Intersects(first.options.writes, second.options.writes)
+            || Intersects(first.options.reads, second.options.writes);
+    }
+
+    bool SystemScheduler::IsOrdered(const System& first, const System& second)
+    {
+        return Contains(first.options.runAfter, second.name) || Contains(first.options.runBefore, second.name)
+            || Contains(second.options.runAfter, first.name) || Contains(second.options.runBefore, first.name);
+    }
+}
@@ -0,0 +1,134 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_SYSTEMSCHEDULER_H
+#define AUX_SYSTEMSCHEDULER_H
+
+#include "engine/jobs/TaskGraph.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace AuxEngine
+{
+    class JobSystem;
+
+    // Phases run in order during the app step of every frame.
+    enum class SystemPhase : int
+    {
+        PreUpdate = 0,      // Before fixed steps and App::OnUpdate
+        Update = 1,         // After App::OnUpdate
+        PostUpdate = 2,
+        Late = 3,           // After App::OnRender
+        MAX = 4
+    };
+
+    constexpr const char* ToString(SystemPhase phase)
+    {
+        switch (phase)
+        {
+        case SystemPhase::PreUpdate:    return "PreUpdate";
+        case SystemPhase::Update:       return "Update";
+        case SystemPhase::PostUpdate:   return "PostUpdate";
+        case SystemPhase::Late:         return "Late";
+        default:                        return "Unknown";
+        }
+    }
+
+    using SystemFunction = void(*)(void* context, float deltaTime);
+
+    struct SystemOptions
+    {
+        // Names of systems in the same phase this one must run after or before.
+        std::vector<std::string> runAfter;
+        std::vector<std::string> runBefore;
+
+        // Systems that declare resources may run in parallel with others in their phase they do not conflict with.
+        // A system that declares none is treated as touching everything and always runs alone.
+        std::vector<TaskResourceId> reads;
+        std::vector<TaskResourceId> writes;
+    };
+
+    struct SystemTiming
+    {
+        std::string name;
+        SystemPhase phase = SystemPhase::Update;
+        uint64_t lastTicks = 0;     // Nanoseconds spent in the system last frame
+    };
+
+    /*
+    * Holds the systems apps register per phase.
+    * On change the systems are sorted by their ordering constraints and packed into flat arrays of function pointers,
+    * grouped into batches of systems that do not conflict. Each batch runs in parallel on the job system.
+    */
+    class SystemScheduler
+    {
+    public:
+        SystemScheduler() = default;
+        SystemScheduler(const SystemScheduler&) = delete;
+        SystemScheduler(SystemScheduler&&) = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+        SystemScheduler& operator=(SystemScheduler&&) = delete;
+        ~SystemScheduler() = default;
+
+        bool AddSystem(const std::string& name, SystemPhase phase, SystemFunction function, void* context, const SystemOptions& options = {});
+
+        // Registers a member function, e.g. AddSystem<&MyApp::UpdateEnemies>("Enemies", SystemPhase::Update, this);
+        template<auto Method, typename T>
+        bool AddSystem(const std::string& name, SystemPhase phase, T* object, const SystemOptions& options = {})
+        {
+            return AddSystem(name, phase, &InvokeMethod<Method, T>, object, options);
+        }
+
+        bool RemoveSystem(const std::string& name);
+        bool HasSystem(const std::string& name) const;
+
+        // Removes every system, for when the app that registered them goes away.
+        void Clear();
+
+        // Sorts and batches the systems. Called by RunPhase when systems changed, returns false on a cycle.
+        // Ordering against an unknown system name is logged as a warning and ignored.
+        bool Compile();
+
+        void RunPhase(SystemPhase phase, float deltaTime, JobSystem* jobSystem);
+
+        std::vector<SystemTiming> GetSystemTimings() const;
+
+    private:
+        struct System
+        {
+            std::string name;
+            SystemPhase phase;
+            SystemFunction function;
+            void* context;
+            SystemOptions options;
+        };
+
+        // Compiled systems of a phase, batch i covers [batchOffsets[i], batchOffsets[i + 1]).
+        struct CompiledPhase
+        {
+            std::vector<SystemFunction> functions;
+            std::vector<void*> contexts;
+            std::vector<uint64_t> ticks;
+            std::vector<size_t> systemIndices;
+            std::vector<size_t> batchOffsets;
+        };
+
+        std::vector<System> systems_;
+        std::array<CompiledPhase, static_cast<size_t>(SystemPhase::MAX)> phases_;
+        bool bIsCompiled_ = false;
+
+        bool CompilePhase(SystemPhase phase);
+        static bool Conflicts(const System& first, const System& second);
+        static bool IsOrdered(const System& first, const System& second);
+
+        template<auto Method, typename T>
+        static void InvokeMethod(void* context, float deltaTime)
+        {
+            (static_cast<T*>(context)->*Method)(deltaTime);
+        }
+    };
+}
+
+#endif // !AUX_SYSTEMSCHEDULER_H
@@ -0,0 +1,252 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/TimerService.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace AuxEngine
+{
+    TimerService::TimerService(uint64_t tickNanoseconds)
+        : tickNanoseconds_(std::max<uint64_t>(tickNanoseconds, 1))
+        , currentTick_(0)
+        , pendingNanoseconds_(0)
+        , activeTimerCount_(0)
+    {
+        slots_.fill(NONE);
+    }
+
+    TimerHandle TimerService::Schedule(double delaySeconds, TimerCallback callback)
+    {
+        return Add(ToTicks(delaySeconds), 0, std::move(callback));
+    }
+
+    TimerHandle TimerService::ScheduleRepeating(double intervalSeconds, TimerCallback callback)
+    {
+        const uint64_t intervalTicks = ToTicks(intervalSeconds);
+        return Add(intervalTicks, intervalTicks, std::move(callback));
+    }
+
+    bool TimerService::Cancel(TimerHandle& handle)
+    {
+        if (!IsScheduled(handle))
+        {
+            handle = TimerHandle();
+            return false;
+        }
+
+        Unlink(handle.index);
+        Release(handle.index);
+        handle = TimerHandle();
+        return true;
+    }
+
+    bool TimerService::IsScheduled(const TimerHandle& handle) const
+    {
+        return handle.index < timers_.size()
+            && timers_[handle.index].bIsActive
+            && timers_[handle.index].generation == handle.generation;
+    }
+
+    void TimerService::Clear()
+    {
+        for (uint32_t index = 0; index < timers_.size(); ++index)
+        {
+            if (timers_[index].bIsActive)
+            {
+                Unlink(index);
+                Release(index);
+            }
+        }
+    }
+
+    void TimerService::Advance(uint64_t deltaNanoseconds)
+    {
+        pendingNanoseconds_ += deltaNanoseconds;
+        const uint64_t targetTick = currentTick_ + pendingNanoseconds_ / tickNanoseconds_;
+        pendingNanoseconds_ %= tickNanoseconds_;
+
+        // Collect first and fire after, so callbacks see the final time and anything they schedule lands relative to it.
+        dueTimers_.clear();
+        while (currentTick_ < targetTick)
+        {
+            // Nothing left in the wheel, skip straight to the target.
+            if (activeTimerCount_ == dueTimers_.size())
+            {
+                currentTick_ = targetTick;
+                break;
+            }
+
+            ++currentTick_;
+
+            // Each time a level wraps, the next level's current slot moves down into the wheel below it.
+            for (int level = 1; level < LEVEL_COUNT; ++level)
+            {
+                if ((currentTick_ & ((uint64_t(1) << (level * SLOT_BITS)) - 1)) != 0)
+                {
+                    break;
+                }
+                Cascade(level, static_cast<uint32_t>((currentTick_ >> (level * SLOT_BITS)) & SLOT_MASK));
+            }
+
+            int32_t& head = slots_[currentTick_ & SLOT_MASK];
+            for (int32_t index = head; index != NONE; index = timers_[index].next)
+            {
+                timers_[index].slot = NONE;
+                dueTimers_.push_back(TimerHandle(static_cast<uint32_t>(index), timers_[index].generation));
+            }
+            head = NONE;
+        }
+
+        for (size_t i = 0; i < dueTimers_.size(); ++i)
+        {
+            const uint32_t index = dueTimers_[i].index;
+            const uint32_t generation = dueTimers_[i].generation;
+            if (!IsScheduled(dueTimers_[i]))
+            {
+                // Cancelled by an earlier callback this frame, its index may already hold a newer timer.
+                continue;
+            }
+
+            // Scheduling from the callback may grow timers_, so the callback runs from a local.
+            TimerCallback callback = std::move(timers_[index].callback);
+            callback();
+
+            Timer& timer = timers_[index];
+            if (!timer.bIsActive || timer.generation != generation)
+            {
+                continue;
+            }
+
+            if (timer.intervalTicks == 0)
+            {
+                Release(index);
+                continue;
+            }
+
+            timer.callback = std::move(callback);
+            timer.expiryTick += timer.intervalTicks;
+            if (timer.expiryTick <= currentTick_)
+            {
+                timer.expiryTick += ((currentTick_ - timer.expiryTick) / timer.intervalTicks + 1) * timer.intervalTicks;
+            }
+            Insert(index);
+        }
+        dueTimers_.clear();
+    }
+
+    TimerHandle TimerService::Add(uint64_t delayTicks, uint64_t intervalTicks, TimerCallback callback)
+    {
+        if (!callback)
+        {
+            return TimerHandle();
+        }
+
+        uint32_t index = 0;
+        if (!freeTimers_.empty())
+        {
+            index = freeTimers_.back();
+            freeTimers_.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(timers_.size());
+            timers_.emplace_back();
+        }
+
+        Timer& timer = timers_[index];
+        timer.callback = std::move(callback);
+        timer.expiryTick = currentTick_ + delayTicks;
+        timer.intervalTicks = intervalTicks;
+        timer.bIsActive = true;
+        ++activeTimerCount_;
+
+        Insert(index);
+        return TimerHandle(index, timer.generation);
+    }
+
+    void TimerService::Release(uint32_t index)
+    {
+        Timer& timer = timers_[index];
+        timer.callback = nullptr;
+        timer.bIsActive = false;
+        ++timer.generation;
+        --activeTimerCount_;
+        freeTimers_.push_back(index);
+    }
+
+    uint64_t TimerService::ToTicks(double seconds) const
+    {
+        // Never due on the tick it was scheduled on, the soonest a timer fires is the next frame.
+        const double ticks = std::ceil(std::max(seconds, 0.0) * 1'000'000'000.0 / static_cast<double>(tickNanoseconds_));
+        return std::max<uint64_t>(static_cast<uint64_t>(ticks), 1);
+    }
+
+    void TimerService::Insert(uint32_t index)
+    {
+        Timer& timer = timers_[index];
+        const uint64_t delta = timer.expiryTick > currentTick_ ? timer.expiryTick - currentTick_ : 0;
+
+        // Timers beyond the top level park in its furthest slot and are re-placed when it cascades.
+        int level = 0;
+        while (level < LEVEL_COUNT - 1 && delta >= (uint64_t(1) << ((level + 1) * SLOT_BITS)))
+        {
+            ++level;
+        }
+
+        const uint64_t placementTick = level == LEVEL_COUNT - 1
+            ? std::min(timer.expiryTick, currentTick_ + (uint64_t(1) << (LEVEL_COUNT * SLOT_BITS)) - 1)
+            : timer.expiryTick;
+        const uint32_t slotIndex = static_cast<uint32_t>((placementTick >> (level * SLOT_BITS)) & SLOT_MASK);
+
+        timer.slot = static_cast<int32_t>(level * SLOT_COUNT + slotIndex);
+        timer.prev = NONE;
+        timer.next = slots_[timer.slot];
+        if (timer.next != NONE)
+        {
+            timers_[timer.next].prev = static_cast<int32_t>(index);
+        }
+        slots_[timer.slot] = static_cast<int32_t>(index);
+    }
+
+    void TimerService::Unlink(uint32_t index)
+    {
+        Timer& timer = timers_[index];
+        if (timer.slot == NONE)
+        {
+            return;
+        }
+
+        if (timer.prev != NONE)
+        {
+            timers_[timer.prev].next = timer.next;
+        }
+        else
+        {
+            slots_[timer.slot] = timer.next;
+        }
+
+        if (timer.next != NONE)
+        {
+            timers_[timer.next].prev = timer.prev;
+        }
+
+        timer.prev = NONE;
+        timer.next = NONE;
+        timer.slot = NONE;
+    }
+
+    void TimerService::Cascade(int level, uint32_t slotIndex)
+    {
+        int32_t& head = slots_[level * SLOT_COUNT + slotIndex];
+        int32_t index = head;
+        head = NONE;
+
+        while (index != NONE)
+        {
+            const int32_t next = timers_[index].next;
+            Insert(static_cast<uint32_t>(index));
+            index = next;
+        }
+    }
+}
@@ -0,0 +1,99 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_TIMERSERVICE_H
+#define AUX_TIMERSERVICE_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace AuxEngine
+{
+    // Identifies a scheduled timer. Handles go stale once their timer fires for the last time or is cancelled, stale handles are ignored.
+    struct TimerHandle
+    {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != UINT32_MAX; }
+    };
+
+    /*
+    * Delayed and repeating callbacks on a hierarchical timing wheel.
+    * Scheduling and cancelling are O(1). Advancing costs one slot visit per elapsed tick plus the timers that fire or move down a level,
+    * so it does not grow with the number of timers waiting.
+    * Time only moves when the engine advances it, by the frame delta time, so timers follow recorded sessions on replay.
+    * Not thread safe, schedule and cancel from the thread driving the engine.
+    */
+    class TimerService
+    {
+    public:
+        using TimerCallback = std::function<void()>;
+
+        // Resolution of the wheel, timers fire on the first frame at or after their tick.
+        explicit TimerService(uint64_t tickNanoseconds = 1'000'000);
+        TimerService(const TimerService&) = delete;
+        TimerService(TimerService&&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+        TimerService& operator=(TimerService&&) = delete;
+        ~TimerService() = default;
+
+        TimerHandle Schedule(double delaySeconds, TimerCallback callback);
+        // Fires every interval, starting one interval from now. Intervals missed during a long frame are skipped rather than fired back to back.
+        TimerHandle ScheduleRepeating(double intervalSeconds, TimerCallback callback);
+
+        // Returns false if the timer already finished or was cancelled. Safe to call from inside a timer callback.
+        bool Cancel(TimerHandle& handle);
+        bool IsScheduled(const TimerHandle& handle) const;
+
+        // Cancels every timer and drops its callback, e.g. before what the callbacks capture is destroyed. Outstanding handles go stale.
+        void Clear();
+
+        // Moves time forward and runs every timer that came due, in expiry order per tick.
+        void Advance(uint64_t deltaNanoseconds);
+
+        size_t GetTimerCount() const { return activeTimerCount_; }
+        uint64_t GetCurrentTick() const { return currentTick_; }
+
+    private:
+        static constexpr int SLOT_BITS{ 8 };
+        static constexpr uint32_t SLOT_COUNT{ 1u << SLOT_BITS };
+        static constexpr uint32_t SLOT_MASK{ SLOT_COUNT - 1 };
+        static constexpr int LEVEL_COUNT{ 4 };
+        static constexpr int32_t NONE{ -1 };
+
+        struct Timer
+        {
+            TimerCallback callback;
+            uint64_t expiryTick = 0;
+            uint64_t intervalTicks = 0;
+            uint32_t generation = 0;
+            int32_t prev = NONE;
+            int32_t next = NONE;
+            int32_t slot = NONE;    // Index into slots_, NONE while not in the wheel
+            bool bIsActive = false;
+        };
+
+        uint64_t tickNanoseconds_;
+        uint64_t currentTick_;
+        uint64_t pendingNanoseconds_;
+
+        std::vector<Timer> timers_;
+        std::vector<uint32_t> freeTimers_;
+        std::array<int32_t, LEVEL_COUNT * SLOT_COUNT> slots_;
+        // Handles rather than indexes, a callback may cancel a queued timer and schedule a new one into the same index.
+        std::vector<TimerHandle> dueTimers_;
+        size_t activeTimerCount_;
+
+        TimerHandle Add(uint64_t delayTicks, uint64_t intervalTicks, TimerCallback callback);
+        void Release(uint32_t index);
+
+        uint64_t ToTicks(double seconds) const;
+        void Insert(uint32_t index);
+        void Unlink(uint32_t index);
+        void Cascade(int level, uint32_t slotIndex);
+    };
+}
+
+#endif // !AUX_TIMERSERVICE_H
@@ -7,6 +7,8 @@
 
 namespace  AuxEngine
 {
+    class EventBus;
+
     class WindowHandler
     {
     public:
@@ -18,10 +20,25 @@ namespace  AuxEngine
         WindowHandler() = default;
         virtual ~WindowHandler() = default;
 
+        // Brings up the platform layer without creating a window, so it can overlap startup work that does not need one.
+        // Main thread only, InitializeWindow runs it itself when it has not run yet.
+        virtual bool InitializeBackend() { return true; }
         virtual bool InitializeWindow( const int width, const int height, const std::string& name ) = 0;
         virtual bool IsWindowOpen() const = 0;
         virtual void ProcessEvents() const = 0;
         virtual void Shutdown() const = 0;
+
+        virtual bool IsFocused() const { return true; }
+        virtual bool IsMinimized() const { return false; }
+
+        // Blocks until a window event arrives or the timeout, in seconds, runs out.
+        virtual void WaitEvents( const double timeoutSeconds ) const = 0;
+
+        // Window events such as resize and focus changes are posted here once set.
+        void SetEventBus( EventBus* eventBus ) { eventBus_ = eventBus; }
+
+    protected:
+        EventBus* eventBus_ = nullptr;
     };
 }
 
@@ -0,0 +1,138 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_COROUTINE_H
+#define AUX_COROUTINE_H
+
+#include "engine/coroutines/CoroutineScheduler.h"
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace AuxEngine
+{
+    CoroutineScheduler& GetCoroutineScheduler();
+
+    class Coroutine;
+
+    struct CoroutinePromise
+    {
+        CoroutinePromise* prev = nullptr;
+        CoroutinePromise* next = nullptr;
+
+        CoroutinePromise() { GetCoroutineScheduler().Register(this); }
+        ~CoroutinePromise() { GetCoroutineScheduler().Unregister(this); }
+
+        Coroutine get_return_object();
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+
+        static void* operator new(size_t size) { return GetCoroutineScheduler().GetFrameAllocator().Allocate(size); }
+        static void operator delete(void* frame, size_t size) { GetCoroutineScheduler().GetFrameAllocator().Deallocate(frame, size); }
+    };
+
+    /*
+    * Fire and forget coroutine for App logic. It starts running as soon as it is called, and its frame frees itself when it finishes.
+    * Start coroutines from the thread that updates the app, they are always resumed there too.
+    * That is the simulation thread while one runs (see Engine::IsSimulationThreaded) and the main thread otherwise.
+    *
+    *   Coroutine MyApp::FadeOut()
+    *   {
+    *       co_await Delay(std::chrono::milliseconds(500));
+    *       co_await RunOnWorker([this]() { SaveGame(); });
+    *       co_await Engine::NextFrame();
+    *   }
+    */
+    class Coroutine
+    {
+    public:
+        using promise_type = CoroutinePromise;
+    };
+
+    inline Coroutine CoroutinePromise::get_return_object()
+    {
+        return Coroutine();
+    }
+
+    // ~~~ Awaitables ~~~
+
+    struct NextFrameAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const;
+        void await_resume() const noexcept {}
+    };
+
+    struct DelayAwaiter
+    {
+        double delaySeconds = 0.0;
+
+        bool await_ready() const noexcept { return delaySeconds <= 0.0; }
+        void await_suspend(std::coroutine_handle<> handle) const;
+        void await_resume() const noexcept {}
+    };
+
+    void ScheduleCoroutineJob(JobFunction job, std::coroutine_handle<> handle);
+
+    template<typename Function>
+    struct WorkerAwaiter
+    {
+        using Result = std::invoke_result_t<Function&>;
+
+        Function function;
+        std::conditional_t<std::is_void_v<Result>, bool, std::optional<Result>> result{};
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            // The awaiter lives in the suspended coroutine frame, so the job can write straight into it.
+            ScheduleCoroutineJob([this]()
+            {
+                if constexpr (std::is_void_v<Result>)
+                {
+                    function();
+                }
+                else
+                {
+                    result.emplace(function());
+                }
+            }, handle);
+        }
+
+        Result await_resume()
+        {
+            if constexpr (!std::is_void_v<Result>)
+            {
+                return std::move(*result);
+            }
+        }
+    };
+
+    // Suspends until the next frame.
+    NextFrameAwaiter NextFrame();
+
+    // Suspends for at least the given time, measured on the engine's timer service.
+    DelayAwaiter Delay(double delaySeconds);
+
+    template<typename Rep, typename Period>
+    DelayAwaiter Delay(std::chrono::duration<Rep, Period> delay)
+    {
+        return Delay(std::chrono::duration<double>(delay).count());
+    }
+
+    // Runs the function on a job system worker and resumes on the thread that updates the app with its result.
+    template<typename Function>
+    WorkerAwaiter<std::decay_t<Function>> RunOnWorker(Function&& function)
+    {
+        return WorkerAwaiter<std::decay_t<Function>>{ std::forward<Function>(function) };
+    }
+}
+
+#endif // !AUX_COROUTINE_H
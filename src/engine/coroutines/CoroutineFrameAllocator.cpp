@@ -0,0 +1,77 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/coroutines/CoroutineFrameAllocator.h"
+
+#include <new>
+
+namespace AuxEngine
+{
+    CoroutineFrameAllocator::CoroutineFrameAllocator()
+        : chunkOffset_(CHUNK_SIZE)
+        , liveFrameCount_(0)
+    {
+        freeLists_.fill(nullptr);
+    }
+
+    void* CoroutineFrameAllocator::Allocate(size_t size)
+    {
+        ++liveFrameCount_;
+
+        const size_t sizeClass = GetSizeClass(size);
+        if (sizeClass >= SIZE_CLASS_COUNT)
+        {
+            return ::operator new(size);
+        }
+
+        if (FreeBlock* block = freeLists_[sizeClass])
+        {
+            freeLists_[sizeClass] = block->next;
+            return block;
+        }
+
+        const size_t blockSize = MIN_BLOCK_SIZE << sizeClass;
+        if (chunkOffset_ + blockSize > CHUNK_SIZE)
+        {
+            chunks_.push_back(std::make_unique<std::byte[]>(CHUNK_SIZE));
+            chunkOffset_ = 0;
+        }
+
+        // Block sizes are powers of two from 64 bytes, so every block stays aligned to the default new alignment.
+        void* block = chunks_.back().get() + chunkOffset_;
+        chunkOffset_ += blockSize;
+        return block;
+    }
+
+    void CoroutineFrameAllocator::Deallocate(void* block, size_t size)
+    {
+        if (!block)
+        {
+            return;
+        }
+
+        --liveFrameCount_;
+
+        const size_t sizeClass = GetSizeClass(size);
+        if (sizeClass >= SIZE_CLASS_COUNT)
+        {
+            ::operator delete(block);
+            return;
+        }
+
+        FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+        freeBlock->next = freeLists_[sizeClass];
+        freeLists_[sizeClass] = freeBlock;
+    }
+
+    size_t CoroutineFrameAllocator::GetSizeClass(size_t size)
+    {
+        size_t sizeClass = 0;
+        size_t blockSize = MIN_BLOCK_SIZE;
+        while (blockSize < size && sizeClass < SIZE_CLASS_COUNT)
+        {
+            blockSize <<= 1;
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+}
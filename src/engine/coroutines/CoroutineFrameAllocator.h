@@ -0,0 +1,53 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_COROUTINEFRAMEALLOCATOR_H
+#define AUX_COROUTINEFRAMEALLOCATOR_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace AuxEngine
+{
+    /*
+    * Pool for coroutine frames. Frames are rounded up to a power of two size class and recycled through a free list per class,
+    * memory is carved out of large chunks and only returned when the allocator is destroyed. Frames above the largest class go to the heap.
+    * Not thread safe, coroutines are created and destroyed on the thread that updates the app.
+    */
+    class CoroutineFrameAllocator
+    {
+        static constexpr size_t MIN_BLOCK_SIZE{ 64 };
+        static constexpr size_t SIZE_CLASS_COUNT{ 7 };      // 64 bytes up to 4KB
+        static constexpr size_t CHUNK_SIZE{ 64 * 1024 };
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+    public:
+        CoroutineFrameAllocator();
+        CoroutineFrameAllocator(const CoroutineFrameAllocator&) = delete;
+        CoroutineFrameAllocator(CoroutineFrameAllocator&&) = delete;
+        CoroutineFrameAllocator& operator=(const CoroutineFrameAllocator&) = delete;
+        CoroutineFrameAllocator& operator=(CoroutineFrameAllocator&&) = delete;
+        ~CoroutineFrameAllocator() = default;
+
+        void* Allocate(size_t size);
+        void Deallocate(void* block, size_t size);
+
+        size_t GetLiveFrameCount() const { return liveFrameCount_; }
+        size_t GetReservedBytes() const { return chunks_.size() * CHUNK_SIZE; }
+
+    private:
+        std::array<FreeBlock*, SIZE_CLASS_COUNT> freeLists_;
+        std::vector<std::unique_ptr<std::byte[]>> chunks_;
+        size_t chunkOffset_;
+        size_t liveFrameCount_;
+
+        static size_t GetSizeClass(size_t size);
+    };
+}
+
+#endif // !AUX_COROUTINEFRAMEALLOCATOR_H
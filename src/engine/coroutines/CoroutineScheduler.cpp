@@ -0,0 +1,148 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/coroutines/CoroutineScheduler.h"
+#include "engine/coroutines/Coroutine.h"
+
+#include "engine/Engine.h"
+#include "engine/TimerService.h"
+
+namespace AuxEngine
+{
+    // Services of the engine driving this thread, its job workers and simulation thread included. The default engine on threads no engine drives.
+    static const ServiceRegistry& GetServices()
+    {
+        const ServiceRegistry* services = ServiceRegistry::GetCurrent();
+        return services ? *services : Engine::Get().GetServices();
+    }
+
+    CoroutineScheduler& GetCoroutineScheduler()
+    {
+        return *GetServices().Get<CoroutineScheduler>();
+    }
+
+    void NextFrameAwaiter::await_suspend(std::coroutine_handle<> handle) const
+    {
+        GetCoroutineScheduler().ResumeNextUpdate(handle);
+    }
+
+    void DelayAwaiter::await_suspend(std::coroutine_handle<> handle) const
+    {
+        GetCoroutineScheduler().ResumeAfter(*GetServices().Get<TimerService>(), delaySeconds, handle);
+    }
+
+    void ScheduleCoroutineJob(JobFunction job, std::coroutine_handle<> handle)
+    {
+        GetCoroutineScheduler().ResumeAfterJob(*GetServices().Get<JobSystem>(), std::move(job), handle);
+    }
+
+    NextFrameAwaiter NextFrame()
+    {
+        return NextFrameAwaiter();
+    }
+
+    DelayAwaiter Delay(double delaySeconds)
+    {
+        return DelayAwaiter(delaySeconds);
+    }
+
+    CoroutineScheduler::CoroutineScheduler()
+        : liveHead_(nullptr)
+        , liveCount_(0)
+    {}
+
+    void CoroutineScheduler::ResumeNextUpdate(std::coroutine_handle<> handle)
+    {
+        ready_.push_back(handle);
+    }
+
+    void CoroutineScheduler::ResumeAfter(TimerService& timers, double delaySeconds, std::coroutine_handle<> handle)
+    {
+        timers.Schedule(delaySeconds, [this, handle]() { ready_.push_back(handle); });
+    }
+
+    void CoroutineScheduler::ResumeAfterJob(JobSystem& jobSystem, JobFunction job, std::coroutine_handle<> handle)
+    {
+        jobSystem.Schedule([this, job = std::move(job), handle]()
+        {
+            job();
+
+            std::lock_guard<std::mutex> lock(postedMutex_);
+            posted_.push_back(handle);
+        }, &workerJobs_);
+    }
+
+    void CoroutineScheduler::Update(JobSystem* jobSystem)
+    {
+        // Without worker threads nobody else picks up coroutine jobs, so the main thread runs them here.
+        if (jobSystem && jobSystem->GetWorkerCount() <= 1)
+        {
+            while (!workerJobs_.IsComplete() && jobSystem->RunPendingJob())
+            {
+            }
+        }
+
+        resuming_.swap(ready_);
+        {
+            std::lock_guard<std::mutex> lock(postedMutex_);
+            resuming_.insert(resuming_.end(), posted_.begin(), posted_.end());
+            posted_.clear();
+        }
+
+        for (std::coroutine_handle<> handle : resuming_)
+        {
+            handle.resume();
+        }
+        resuming_.clear();
+    }
+
+    void CoroutineScheduler::Shutdown(JobSystem* jobSystem)
+    {
+        if (jobSystem)
+        {
+            jobSystem->Wait(workerJobs_);
+        }
+
+        ready_.clear();
+        resuming_.clear();
+        {
+            std::lock_guard<std::mutex> lock(postedMutex_);
+            posted_.clear();
+        }
+
+        // Destroying a frame unregisters its promise, which moves the head along.
+        while (liveHead_)
+        {
+            std::coroutine_handle<CoroutinePromise>::from_promise(*liveHead_).destroy();
+        }
+    }
+
+    void CoroutineScheduler::Register(CoroutinePromise* promise)
+    {
+        promise->prev = nullptr;
+        promise->next = liveHead_;
+        if (liveHead_)
+        {
+            liveHead_->prev = promise;
+        }
+        liveHead_ = promise;
+        ++liveCount_;
+    }
+
+    void CoroutineScheduler::Unregister(CoroutinePromise* promise)
+    {
+        if (promise->prev)
+        {
+            promise->prev->next = promise->next;
+        }
+        else
+        {
+            liveHead_ = promise->next;
+        }
+
+        if (promise->next)
+        {
+            promise->next->prev = promise->prev;
+        }
+        --liveCount_;
+    }
+}
@@ -0,0 +1,72 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_COROUTINESCHEDULER_H
+#define AUX_COROUTINESCHEDULER_H
+
+#include "engine/coroutines/CoroutineFrameAllocator.h"
+#include "engine/jobs/JobSystem.h"
+
+#include <coroutine>
+#include <mutex>
+#include <vector>
+
+namespace AuxEngine
+{
+    class TimerService;
+    struct CoroutinePromise;
+
+    /*
+    * Resumes suspended coroutines from the engine loop, always on the thread that updates the app, the simulation thread while one runs.
+    * Coroutines waiting on a timer or a worker cost nothing per frame, only coroutines that are ready get touched.
+    */
+    class CoroutineScheduler
+    {
+        friend struct CoroutinePromise;
+    public:
+        CoroutineScheduler();
+        CoroutineScheduler(const CoroutineScheduler&) = delete;
+        CoroutineScheduler(CoroutineScheduler&&) = delete;
+        CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+        CoroutineScheduler& operator=(CoroutineScheduler&&) = delete;
+        // Shutdown must run first, frames still alive at destruction are leaked rather than destroyed without the engine.
+        ~CoroutineScheduler() = default;
+
+        // Resumes the coroutine on the next Update. Main thread only.
+        void ResumeNextUpdate(std::coroutine_handle<> handle);
+
+        // Resumes the coroutine on the next Update after the delay, in seconds, has passed on the timer service.
+        void ResumeAfter(TimerService& timers, double delaySeconds, std::coroutine_handle<> handle);
+
+        // Runs the job on a worker, then resumes the coroutine on the next Update.
+        void ResumeAfterJob(JobSystem& jobSystem, JobFunction job, std::coroutine_handle<> handle);
+
+        // Resumes every coroutine that became ready since the last Update. Coroutines suspending again wait for a later Update.
+        void Update(JobSystem* jobSystem);
+
+        // Waits for worker jobs still in flight, then destroys every suspended coroutine.
+        void Shutdown(JobSystem* jobSystem);
+
+        size_t GetLiveCount() const { return liveCount_; }
+        CoroutineFrameAllocator& GetFrameAllocator() { return frameAllocator_; }
+
+    private:
+        CoroutineFrameAllocator frameAllocator_;
+
+        std::vector<std::coroutine_handle<>> ready_;
+        std::vector<std::coroutine_handle<>> resuming_;
+
+        // Worker jobs hand their coroutines back through here.
+        std::mutex postedMutex_;
+        std::vector<std::coroutine_handle<>> posted_;
+        JobCounter workerJobs_;
+
+        // Every live coroutine, so the ones still suspended can be destroyed at shutdown.
+        CoroutinePromise* liveHead_;
+        size_t liveCount_;
+
+        void Register(CoroutinePromise* promise);
+        void Unregister(CoroutinePromise* promise);
+    };
+}
+
+#endif // !AUX_COROUTINESCHEDULER_H
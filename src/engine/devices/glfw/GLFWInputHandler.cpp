@@ -4,11 +4,13 @@
 #include "engine/devices/glfw/GLFWWindowHandler.h"
 
 #include "engine/DebugLog.h"
-#include "engine/Engine.h"
 #include "engine/EngineClock.h"
+#include "engine/Profiler.h"
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+
 namespace  AuxEngine
 {
     std::string input_device_to_string(InputDevice device) {
@@ -21,46 +23,83 @@ namespace  AuxEngine
         }
     }
 
+    GLFWInputHandler* GLFWInputHandler::GetWindowInputHandler(GLFWwindow* window)
+    {
+        const GLFWWindowHandler* windowHandler = static_cast<GLFWWindowHandler*>(glfwGetWindowUserPointer(window));
+        return windowHandler ? windowHandler->inputHandler_ : nullptr;
+    }
+
     void GLFWInputHandler::InputDeviceConnectionCallback(int inputDeviceId, int eventId)
     {
-        if (eventId == GLFW_CONNECTED)
-        {
-            GLFWInputHandler::Get().DeviceConnected(inputDeviceId, InputDevice::Gamepad);
-        }
-        else
+        for (GLFWInputHandler* inputHandler : joystickListeners_)
         {
-            GLFWInputHandler::Get().DeviceDisconnected(inputDeviceId, InputDevice::Gamepad);
+            if (eventId == GLFW_CONNECTED)
+            {
+                inputHandler->DeviceConnected(inputDeviceId, InputDevice::Gamepad);
+            }
+            else
+            {
+                inputHandler->DeviceDisconnected(inputDeviceId, InputDevice::Gamepad);
+            }
         }
     }
 
     void GLFWInputHandler::KeyboardCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
     {
-        GLFWInputHandler::Get().OnKeyInput(key, scancode, action, mods);
+        if (GLFWInputHandler* inputHandler = GetWindowInputHandler(window))
+        {
+            inputHandler->OnKeyInput(key, scancode, action, mods);
+        }
     }
 
     void GLFWInputHandler::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
     {
-        GLFWInputHandler::Get().OnMouseButtonInput(button, action, mods);
+        if (GLFWInputHandler* inputHandler = GetWindowInputHandler(window))
+        {
+            inputHandler->OnMouseButtonInput(button, action, mods);
+        }
     }
 
     void GLFWInputHandler::MouseScrollCallback(GLFWwindow* window, double xOffset, double yOffset)
     {
-        GLFWInputHandler::Get().OnMouseScrollInput(xOffset, yOffset);
+        if (GLFWInputHandler* inputHandler = GetWindowInputHandler(window))
+        {
+            inputHandler->OnMouseScrollInput(xOffset, yOffset);
+        }
     }
 
     GLFWInputHandler::GLFWInputHandler() :
-        windowHandler_( nullptr )
+        windowHandler_( nullptr ),
+        gatheredState_(),
+        publishedState_(),
+        dispatchedKeys_(),
+        dispatchedGamepadButtons_(),
+        dispatchedGamepads_( 0 ),
+        sampledGamepadButtons_(),
+        lastSampledButtons_()
     {}
 
+    GLFWInputHandler::~GLFWInputHandler()
+    {
+        std::erase(joystickListeners_, this);
+    }
+
     bool GLFWInputHandler::Initialize( WindowHandler* windowHandler )
     {
-        windowHandler_ = static_cast<GLFWWindowHandler*>( windowHandler );
+        GLFWWindowHandler* glfwWindowHandler = static_cast<GLFWWindowHandler*>( windowHandler );
+        windowHandler_ = glfwWindowHandler;
         if (!windowHandler_)
         {
             DEBUG_LOG(LOG::ERRORLOG, "Failed to init GLFW Input Handler! GLFW Window handler is NULL!");
             return false;
         }
 
+        glfwWindowHandler->inputHandler_ = this;
+        if (std::find(joystickListeners_.begin(), joystickListeners_.end(), this) == joystickListeners_.end())
+        {
+            joystickListeners_.push_back(this);
+        }
+
         glfwSetKeyCallback(windowHandler_->window_, KeyboardCallback);
         glfwSetMouseButtonCallback(windowHandler_->window_, MouseButtonCallback);
         glfwSetScrollCallback(windowHandler_->window_, MouseScrollCallback);
@@ -73,19 +112,36 @@ namespace  AuxEngine
 
     void GLFWInputHandler::Update(const float deltaTime)
     {
+        AUX_PROFILE_SCOPE("GLFWInputHandler::Update");
         glfwPollEvents();
 
-        const int currTimestamp = Engine::Get().GetClock().GetCurrentTicks();
+        // Changes sampled while the last frame slept come first, so this frame's poll does not repeat them with a later timestamp.
+        for (const SampledGamepadButton& sampledButton : sampledGamepadButtons_)
+        {
+            InputHandler::ProcessGamepadButtonInput(sampledButton.gamepadId, sampledButton.inputEvent);
+        }
+        sampledGamepadButtons_.clear();
+
+        const uint64_t currTimestamp = EngineClock::GetCurrentTimeInNanoSeconds();
+
+        gatheredState_.connectedGamepads = 0;
+        gatheredState_.gamepadButtons.fill(0);
 
         for (int i = 0; i < GetMaxGamepadCount(); ++i)
         {
-            if (IsGamepadConnected(static_cast<GamepadId>(i)))
+            if (IsGamepadPresent(static_cast<GamepadId>(i)))
             {
+                gatheredState_.connectedGamepads |= 1u << i;
+
                 GLFWgamepadstate state;
                 if (glfwGetGamepadState(i, &state))
                 {
                     for (int n = 0; n < static_cast<int>(GamepadButton::MAX); ++n)
                     {
+                        if (state.buttons[n] == GLFW_PRESS)
+                        {
+                            gatheredState_.gamepadButtons[i] |= 1u << n;
+                        }
                         InputHandler::ProcessGamepadButtonInput(static_cast<GamepadId>(i), InputEvent(n, state.buttons[n], 0.0f, currTimestamp));
                     }
 
@@ -97,16 +153,73 @@ namespace  AuxEngine
             }
         }
 
+        lastSampledButtons_ = gatheredState_.gamepadButtons;
         ExecuteInputBindings();
     }
 
+    void GLFWInputHandler::SampleGamepads()
+    {
+        const uint64_t timestamp = EngineClock::GetCurrentTimeInNanoSeconds();
+
+        // Only the gamepads the last Update found, asking GLFW about empty slots can be slow.
+        for (int i = 0; i < GetMaxGamepadCount(); ++i)
+        {
+            GLFWgamepadstate state;
+            if ((gatheredState_.connectedGamepads & (1u << i)) == 0 || !glfwGetGamepadState(i, &state))
+            {
+                continue;
+            }
+
+            uint32_t buttons = 0;
+            for (int n = 0; n < static_cast<int>(GamepadButton::MAX); ++n)
+            {
+                if (state.buttons[n] == GLFW_PRESS)
+                {
+                    buttons |= 1u << n;
+                }
+            }
+
+            const uint32_t changedButtons = buttons ^ lastSampledButtons_[i];
+            for (int n = 0; n < static_cast<int>(GamepadButton::MAX); ++n)
+            {
+                if (changedButtons & (1u << n))
+                {
+                    sampledGamepadButtons_.push_back(SampledGamepadButton(static_cast<GamepadId>(i), InputEvent(n, state.buttons[n], 0.0f, timestamp)));
+                }
+            }
+            lastSampledButtons_[i] = buttons;
+        }
+    }
+
     bool GLFWInputHandler::IsKeyDown(Key key) const
     {
-        return windowHandler_ != nullptr && glfwGetKey(windowHandler_->window_, static_cast<int>(key)) == GLFW_PRESS;
+        const int keyIndex = static_cast<int>(key);
+        if (keyIndex < 0 || keyIndex >= KEY_COUNT)
+        {
+            return false;
+        }
+
+        if (IsDeferredDispatch())
+        {
+            return (dispatchedKeys_[keyIndex / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (keyIndex % 64))) != 0;
+        }
+
+        return windowHandler_ != nullptr && glfwGetKey(windowHandler_->window_, keyIndex) == GLFW_PRESS;
     }
 
     bool GLFWInputHandler::IsGamepadButtonDown(GamepadId gamepadId, GamepadButton button) const
     {
+        if (button == GamepadButton::Unknown || button == GamepadButton::MAX)
+        {
+            return false;
+        }
+
+        if (IsDeferredDispatch())
+        {
+            return IsGamepadConnected(gamepadId)
+                && (dispatchedGamepadButtons_[static_cast<int>(gamepadId)].load(std::memory_order_relaxed) & (1u << static_cast<int>(button))) != 0;
+        }
+
         if (IsGamepadConnected(gamepadId))
         {
             GLFWgamepadstate state;
@@ -119,6 +232,16 @@ namespace  AuxEngine
     }
 
     bool GLFWInputHandler::IsGamepadConnected(GamepadId gamepadId) const
+    {
+        if (IsDeferredDispatch())
+        {
+            return (dispatchedGamepads_.load(std::memory_order_relaxed) & (1u << static_cast<int>(gamepadId))) != 0;
+        }
+
+        return IsGamepadPresent(gamepadId);
+    }
+
+    bool GLFWInputHandler::IsGamepadPresent(GamepadId gamepadId) const
     {
         if (!InputHandler::IsGamepadConnected(gamepadId))
         {
@@ -138,6 +261,26 @@ namespace  AuxEngine
         DEBUG_LOG(LOG::INFO, "{} Disconnected Id = {} ", input_device_to_string(device), inputDeviceId);
     }
 
+    void GLFWInputHandler::OnPublishDeferredInput()
+    {
+        publishedState_ = gatheredState_;
+    }
+
+    void GLFWInputHandler::OnDispatchDeferredInput()
+    {
+        for (int i = 0; i < KEY_WORD_COUNT; ++i)
+        {
+            dispatchedKeys_[i].store(publishedState_.keys[i], std::memory_order_relaxed);
+        }
+
+        for (int i = 0; i < GAMEPAD_COUNT; ++i)
+        {
+            dispatchedGamepadButtons_[i].store(publishedState_.gamepadButtons[i], std::memory_order_relaxed);
+        }
+
+        dispatchedGamepads_.store(publishedState_.connectedGamepads, std::memory_order_relaxed);
+    }
+
     void GLFWInputHandler::RefreshConnectedInputDevices()
     {
         for (int i = 0; i < GetMaxGamepadCount(); ++i)
@@ -151,19 +294,33 @@ namespace  AuxEngine
 
     void GLFWInputHandler::OnKeyInput(int key, int scancode, int action, int mods)
     {
-        const int currTimestamp = Engine::Get().GetClock().GetCurrentTicks();
+        // Mirrors glfwGetKey, a repeat still counts as pressed.
+        if (key >= 0 && key < KEY_COUNT)
+        {
+            const uint64_t keyBit = uint64_t(1) << (key % 64);
+            if (action == GLFW_RELEASE)
+            {
+                gatheredState_.keys[key / 64] &= ~keyBit;
+            }
+            else
+            {
+                gatheredState_.keys[key / 64] |= keyBit;
+            }
+        }
+
+        const uint64_t currTimestamp = EngineClock::GetCurrentTimeInNanoSeconds();
         InputHandler::ProcessKeyboardInput(InputEvent(key, action, 0.0f, currTimestamp));
     }
 
     void GLFWInputHandler::OnMouseButtonInput(int button, int action, int mods)
     {
-        const int currTimestamp = Engine::Get().GetClock().GetCurrentTicks();
+        const uint64_t currTimestamp = EngineClock::GetCurrentTimeInNanoSeconds();
         InputHandler::ProcessMouseButtonInput(InputEvent(button, action, 0.0f, currTimestamp));
     }
 
     void GLFWInputHandler::OnMouseScrollInput(double xOffset, double yOffset)
     {
-        const int currTimestamp = Engine::Get().GetClock().GetCurrentTicks();
+        const uint64_t currTimestamp = EngineClock::GetCurrentTimeInNanoSeconds();
 
         InputHandler::ProcessMouseScrollAxisInput(InputEvent(
             static_cast<int>(MouseScrollAxis::X), static_cast<int>(AxisAction::Tilted), static_cast<float>(xOffset), currTimestamp));
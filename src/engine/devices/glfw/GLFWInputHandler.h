@@ -4,7 +4,11 @@
 #define AUX_GLFW_INPUTHANDLER_H
 
 #include "engine/InputHandler.h"
-#include "engine/Singleton.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
 
 class GLFWwindow;
 
@@ -14,10 +18,23 @@ namespace  AuxEngine
     
     /*
     * GLFW Input Handler is responsible for handling all inputs from all gamepads, keyboards and mice.
-    * Functions as singleton to support callbacks of GLFW lib, routes inputs to desired controller objects.
+    * Window callbacks reach the handler through the window's user pointer. Joystick connection callbacks are global in GLFW,
+    * so they go to every initialized handler.
     */
-    class GLFWInputHandler : public Singleton<GLFWInputHandler>, public InputHandler
+    class GLFWInputHandler : public InputHandler
     {
+        static constexpr int KEY_COUNT{ static_cast<int>(Key::MAX) };
+        static constexpr int KEY_WORD_COUNT{ (KEY_COUNT + 63) / 64 };
+        static constexpr int GAMEPAD_COUNT{ static_cast<int>(GamepadId::MAX) };
+
+        // What IsKeyDown, IsGamepadButtonDown and IsGamepadConnected answer while dispatch is deferred. One bit per key, button and gamepad.
+        struct PolledInputState
+        {
+            std::array<uint64_t, KEY_WORD_COUNT> keys = {};
+            std::array<uint32_t, GAMEPAD_COUNT> gamepadButtons = {};
+            uint32_t connectedGamepads = 0;
+        };
+
     public:
         GLFWInputHandler( const GLFWInputHandler& ) = delete;
         GLFWInputHandler& operator=( const GLFWInputHandler& ) = delete;
@@ -25,7 +42,7 @@ namespace  AuxEngine
         GLFWInputHandler& operator=( GLFWInputHandler&& ) = delete;
 
         GLFWInputHandler();
-        ~GLFWInputHandler() override = default;
+        ~GLFWInputHandler() override;
 
         virtual bool Initialize(WindowHandler* windowHandler) override;
         virtual void Update(const float deltaTime) override;
@@ -33,20 +50,51 @@ namespace  AuxEngine
         virtual bool IsGamepadButtonDown(GamepadId gamepadId, GamepadButton button) const override;
         virtual bool IsGamepadConnected(GamepadId gamepadId) const override;
 
+        // Reads the buttons of connected gamepads between frames, main thread only. Changes keep the time they were sampled at
+        // and reach the bindings in order on the next Update, so presses are timestamped accurately and short taps are not missed.
+        void SampleGamepads();
+
     protected:
         virtual void OnDeviceConnected(const int inputDeviceId, InputDevice device) override;
         virtual void OnDeviceDisconnected(const int inputDeviceId, InputDevice device) override;
+        virtual void OnPublishDeferredInput() override;
+        virtual void OnDispatchDeferredInput() override;
 
     private:
         const GLFWWindowHandler* windowHandler_;
 
+        // GLFW may only be queried from the main thread, so Update gathers the polled state there and it is published with the input.
+        // The dispatched copy is atomic, polls may come from the main thread as well as the one dispatching.
+        PolledInputState gatheredState_;
+        PolledInputState publishedState_;
+        std::array<std::atomic<uint64_t>, KEY_WORD_COUNT> dispatchedKeys_;
+        std::array<std::atomic<uint32_t>, GAMEPAD_COUNT> dispatchedGamepadButtons_;
+        std::atomic<uint32_t> dispatchedGamepads_;
+
+        struct SampledGamepadButton
+        {
+            GamepadId gamepadId;
+            InputEvent inputEvent;
+        };
+
+        // Button changes seen by SampleGamepads since the last Update, and the button state they were compared against.
+        std::vector<SampledGamepadButton> sampledGamepadButtons_;
+        std::array<uint32_t, GAMEPAD_COUNT> lastSampledButtons_;
+
+        // Main thread only, GLFW invokes its callbacks from glfwPollEvents.
+        inline static std::vector<GLFWInputHandler*> joystickListeners_;
+
         // Detects all devices connected for input.
         void RefreshConnectedInputDevices();
 
+        // Asks GLFW directly, main thread only.
+        bool IsGamepadPresent(GamepadId gamepadId) const;
+
         void OnKeyInput(int key, int scancode, int action, int mods);
         void OnMouseButtonInput(int button, int action, int mods);
         void OnMouseScrollInput(double xOffset, double yOffset);
         
+        static GLFWInputHandler* GetWindowInputHandler(GLFWwindow* window);
         static void InputDeviceConnectionCallback(int inputDeviceId, int eventId);
         static void KeyboardCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
         static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
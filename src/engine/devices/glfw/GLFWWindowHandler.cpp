@@ -2,18 +2,49 @@
 
 #include "engine/devices/glfw/GLFWWindowHandler.h"
 #include "engine/DebugLog.h"
+#include "engine/events/EngineEvents.h"
+#include "engine/events/EventBus.h"
 
 #include <GLFW/glfw3.h>
 
 namespace  AuxEngine
 {
+    void GLFWWindowHandler::WindowSizeCallback( GLFWwindow* window, int width, int height )
+    {
+        const GLFWWindowHandler* windowHandler = static_cast<GLFWWindowHandler*>( glfwGetWindowUserPointer( window ) );
+        if( windowHandler && windowHandler->eventBus_ )
+        {
+            windowHandler->eventBus_->Post( WindowResizedEvent( width, height ) );
+        }
+    }
+
+    void GLFWWindowHandler::WindowFocusCallback( GLFWwindow* window, int focused )
+    {
+        const GLFWWindowHandler* windowHandler = static_cast<GLFWWindowHandler*>( glfwGetWindowUserPointer( window ) );
+        if( windowHandler && windowHandler->eventBus_ )
+        {
+            windowHandler->eventBus_->Post( WindowFocusChangedEvent( focused == GLFW_TRUE ) );
+        }
+    }
+
     GLFWWindowHandler::GLFWWindowHandler() :
-        window_( nullptr )
+        window_( nullptr ),
+        inputHandler_( nullptr ),
+        bIsBackendInitialized_( false )
     {}
 
+    bool GLFWWindowHandler::InitializeBackend()
+    {
+        if( !bIsBackendInitialized_ )
+        {
+            bIsBackendInitialized_ = glfwInit() == GLFW_TRUE;
+        }
+        return bIsBackendInitialized_;
+    }
+
     bool GLFWWindowHandler::InitializeWindow( const int width, const int height, const std::string& name )
     {
-        if(!glfwInit())
+        if(!InitializeBackend())
         {
             DEBUG_LOG(LOG::ERRORLOG, "Failed to initialize GLFW!");
             return false;
@@ -26,6 +57,10 @@ namespace  AuxEngine
             DEBUG_LOG(LOG::ERRORLOG, "Failed to GLFW Window! Window properties: width:{} height:{} name:{}", width, height, name);
             return false;
         }
+
+        glfwSetWindowUserPointer( window_, this );
+        glfwSetWindowSizeCallback( window_, WindowSizeCallback );
+        glfwSetWindowFocusCallback( window_, WindowFocusCallback );
         return true;
     }
 
@@ -57,6 +92,24 @@ namespace  AuxEngine
         glfwTerminate();
     }
 
+    bool GLFWWindowHandler::IsFocused() const
+    {
+        return window_ != nullptr && glfwGetWindowAttrib( window_, GLFW_FOCUSED ) == GLFW_TRUE;
+    }
+
+    bool GLFWWindowHandler::IsMinimized() const
+    {
+        return window_ != nullptr && glfwGetWindowAttrib( window_, GLFW_ICONIFIED ) == GLFW_TRUE;
+    }
+
+    void GLFWWindowHandler::WaitEvents( const double timeoutSeconds ) const
+    {
+        if( window_ && timeoutSeconds > 0.0 )
+        {
+            glfwWaitEventsTimeout( timeoutSeconds );
+        }
+    }
+
     GLFWwindow* GLFWWindowHandler::GetWindow() const
     {
         return window_;
@@ -9,6 +9,8 @@ class GLFWwindow;
 
 namespace  AuxEngine
 {
+    class GLFWInputHandler;
+
     class GLFWWindowHandler : public WindowHandler
     {
         friend class GLFWInputHandler;
@@ -21,15 +23,24 @@ namespace  AuxEngine
         GLFWWindowHandler();
         ~GLFWWindowHandler() override = default;
 
+        virtual bool InitializeBackend() override;
         virtual bool InitializeWindow( const int width, const int height, const std::string& name ) override;
         virtual bool IsWindowOpen() const override;
         virtual void ProcessEvents() const override;
         virtual void Shutdown() const override;
+        virtual bool IsFocused() const override;
+        virtual bool IsMinimized() const override;
+        virtual void WaitEvents( const double timeoutSeconds ) const override;
 
         GLFWwindow* GetWindow() const;
 
     private:
         GLFWwindow* window_;
+        GLFWInputHandler* inputHandler_;    // Set by the input handler bound to this window, for its callbacks.
+        bool bIsBackendInitialized_;
+
+        static void WindowSizeCallback( GLFWwindow* window, int width, int height );
+        static void WindowFocusCallback( GLFWwindow* window, int focused );
     };
 }
 
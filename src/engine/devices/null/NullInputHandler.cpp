@@ -0,0 +1,237 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/devices/null/NullInputHandler.h"
+
+#include "engine/DebugLog.h"
+#include "engine/EngineClock.h"
+
+namespace  AuxEngine
+{
+    NullInputHandler::NullInputHandler()
+    {
+        keyStates_.fill(false);
+        gamepadConnectedStates_.fill(false);
+        for (int i = 0; i < GAMEPAD_COUNT; ++i)
+        {
+            gamepadButtonStates_[i].fill(false);
+            gamepadAxisStates_[i].fill(0.0f);
+
+            // Neutral trigger values start at -1.0f, matching physical pads.
+            gamepadAxisStates_[i][static_cast<int>(GamepadAxis::LeftTrigger)] = -1.0f;
+            gamepadAxisStates_[i][static_cast<int>(GamepadAxis::RightTrigger)] = -1.0f;
+        }
+    }
+
+    bool NullInputHandler::Initialize(WindowHandler* windowHandler)
+    {
+        // Nothing to hook into, input is fed through the Set functions.
+        return true;
+    }
+
+    void NullInputHandler::Update(const float deltaTime)
+    {
+        const uint64_t currTimestamp = EngineClock::GetCurrentTimeInNanoSeconds();
+
+        std::array<bool, GAMEPAD_COUNT> gamepadConnectedStates;
+        std::array<std::array<bool, GAMEPAD_BUTTON_COUNT>, GAMEPAD_COUNT> gamepadButtonStates;
+        std::array<std::array<float, GAMEPAD_AXIS_COUNT>, GAMEPAD_COUNT> gamepadAxisStates;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            processingInputs_.swap(queuedInputs_);
+            gamepadConnectedStates = gamepadConnectedStates_;
+            gamepadButtonStates = gamepadButtonStates_;
+            gamepadAxisStates = gamepadAxisStates_;
+        }
+
+        for (const QueuedInput& queuedInput : processingInputs_)
+        {
+            switch (queuedInput.device)
+            {
+            case InputDevice::Keyboard:
+                ProcessKeyboardInput(queuedInput.inputEvent);
+                break;
+            case InputDevice::Mouse:
+                if (queuedInput.bIsAxis)
+                {
+                    ProcessMouseScrollAxisInput(queuedInput.inputEvent);
+                }
+                else
+                {
+                    ProcessMouseButtonInput(queuedInput.inputEvent);
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        processingInputs_.clear();
+
+        for (int i = 0; i < GAMEPAD_COUNT; ++i)
+        {
+            const GamepadId gamepadId = static_cast<GamepadId>(i);
+            if (gamepadConnectedStates[i] != IsGamepadConnected(gamepadId))
+            {
+                if (gamepadConnectedStates[i])
+                {
+                    DeviceConnected(i, InputDevice::Gamepad);
+                }
+                else
+                {
+                    DeviceDisconnected(i, InputDevice::Gamepad);
+                }
+            }
+
+            if (!gamepadConnectedStates[i])
+            {
+                continue;
+            }
+
+            for (int n = 0; n < GAMEPAD_BUTTON_COUNT; ++n)
+            {
+                ProcessGamepadButtonInput(gamepadId, InputEvent(n, gamepadButtonStates[i][n] ? 1 : 0, 0.0f, currTimestamp));
+            }
+
+            for (int n = 0; n < GAMEPAD_AXIS_COUNT; ++n)
+            {
+                ProcessGamepadAxisInput(gamepadId, InputEvent(n, static_cast<int>(AxisAction::Tilted), gamepadAxisStates[i][n], currTimestamp));
+            }
+        }
+
+        ExecuteInputBindings();
+    }
+
+    bool NullInputHandler::IsKeyDown(Key key) const
+    {
+        if (key == Key::Unknown || key == Key::MAX)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return keyStates_[static_cast<int>(key)];
+    }
+
+    bool NullInputHandler::IsGamepadButtonDown(GamepadId gamepadId, GamepadButton button) const
+    {
+        if (gamepadId == GamepadId::MAX || button == GamepadButton::Unknown || button == GamepadButton::MAX)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return gamepadConnectedStates_[static_cast<int>(gamepadId)] && gamepadButtonStates_[static_cast<int>(gamepadId)][static_cast<int>(button)];
+    }
+
+    void NullInputHandler::SetKey(Key key, bool bIsDown)
+    {
+        if (key == Key::Unknown || key == Key::MAX)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            keyStates_[static_cast<int>(key)] = bIsDown;
+        }
+        QueueInput(InputDevice::Keyboard, InputEvent(static_cast<int>(key), static_cast<int>(bIsDown ? InputAction::Pressed : InputAction::Released), 0.0f, EngineClock::GetCurrentTimeInNanoSeconds()), false);
+    }
+
+    void NullInputHandler::SetMouseButton(MouseButton button, bool bIsDown)
+    {
+        if (button == MouseButton::Unknown || button == MouseButton::MAX)
+        {
+            return;
+        }
+
+        QueueInput(InputDevice::Mouse, InputEvent(static_cast<int>(button), static_cast<int>(bIsDown ? InputAction::Pressed : InputAction::Released), 0.0f, EngineClock::GetCurrentTimeInNanoSeconds()), false);
+    }
+
+    void NullInputHandler::ScrollMouse(MouseScrollAxis axis, float value)
+    {
+        if (axis == MouseScrollAxis::MAX || value == 0.0f)
+        {
+            return;
+        }
+
+        QueueInput(InputDevice::Mouse, InputEvent(static_cast<int>(axis), static_cast<int>(AxisAction::Tilted), value, EngineClock::GetCurrentTimeInNanoSeconds()), true);
+    }
+
+    void NullInputHandler::SetGamepadConnected(GamepadId gamepadId, bool bIsConnected)
+    {
+        if (gamepadId == GamepadId::MAX)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        gamepadConnectedStates_[static_cast<int>(gamepadId)] = bIsConnected;
+    }
+
+    void NullInputHandler::SetGamepadButton(GamepadId gamepadId, GamepadButton button, bool bIsDown)
+    {
+        if (gamepadId == GamepadId::MAX || button == GamepadButton::Unknown || button == GamepadButton::MAX)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        gamepadButtonStates_[static_cast<int>(gamepadId)][static_cast<int>(button)] = bIsDown;
+    }
+
+    void NullInputHandler::SetGamepadAxis(GamepadId gamepadId, GamepadAxis axis, float value)
+    {
+        if (gamepadId == GamepadId::MAX || axis == GamepadAxis::Unknown || axis == GamepadAxis::MAX)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        gamepadAxisStates_[static_cast<int>(gamepadId)][static_cast<int>(axis)] = value;
+    }
+
+    void NullInputHandler::OnDeviceConnected(const int inputDeviceId, InputDevice device)
+    {
+        DEBUG_LOG(LOG::INFO, "Null gamepad connected Id = {} ", inputDeviceId);
+    }
+
+    void NullInputHandler::OnDeviceDisconnected(const int inputDeviceId, InputDevice device)
+    {
+        DEBUG_LOG(LOG::INFO, "Null gamepad disconnected Id = {} ", inputDeviceId);
+    }
+
+    void NullInputHandler::OnReplayInput(const unsigned int inputDeviceId, const InputEvent& inputEvent, bool bIsAxis)
+    {
+        if (inputEvent.button < 0)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (inputDeviceId == static_cast<unsigned int>(GetKeyboardDeviceId()))
+        {
+            if (!bIsAxis && inputEvent.button < KEY_COUNT)
+            {
+                keyStates_[inputEvent.button] = inputEvent.action != static_cast<int>(InputAction::Released);
+            }
+        }
+        else if (inputDeviceId < GAMEPAD_COUNT)
+        {
+            // Only a connected pad records input, and Update keeps polling the held state since only changes were recorded.
+            gamepadConnectedStates_[inputDeviceId] = true;
+            if (!bIsAxis && inputEvent.button < GAMEPAD_BUTTON_COUNT)
+            {
+                gamepadButtonStates_[inputDeviceId][inputEvent.button] = inputEvent.action != static_cast<int>(InputAction::Released);
+            }
+            else if (bIsAxis && inputEvent.button < GAMEPAD_AXIS_COUNT)
+            {
+                gamepadAxisStates_[inputDeviceId][inputEvent.button] = inputEvent.value;
+            }
+        }
+    }
+
+    void NullInputHandler::QueueInput(InputDevice device, const InputEvent& inputEvent, bool bIsAxis)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queuedInputs_.push_back(QueuedInput(device, inputEvent, bIsAxis));
+    }
+}
@@ -0,0 +1,73 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_NULL_INPUTHANDLER_H
+#define AUX_NULL_INPUTHANDLER_H
+
+#include "engine/InputHandler.h"
+
+#include <mutex>
+#include <vector>
+
+namespace  AuxEngine
+{
+    /*
+    * Input handler for display-less hosts, fed programmatically instead of by a platform backend.
+    * Keyboard and mouse changes are queued and applied in order on the next Update, gamepad state is held and polled every Update like a physical pad.
+    * The Set functions are safe to call from any thread. Replayed events update the same state, so a replay is polled like the recorded session.
+    */
+    class NullInputHandler : public InputHandler
+    {
+        struct QueuedInput
+        {
+            InputDevice device = InputDevice::Other;
+            InputEvent inputEvent;
+            bool bIsAxis = false;
+        };
+
+        static constexpr int KEY_COUNT{ static_cast<int>(Key::MAX) };
+        static constexpr int GAMEPAD_COUNT{ static_cast<int>(GamepadId::MAX) };
+        static constexpr int GAMEPAD_BUTTON_COUNT{ static_cast<int>(GamepadButton::MAX) };
+        static constexpr int GAMEPAD_AXIS_COUNT{ static_cast<int>(GamepadAxis::MAX) };
+
+    public:
+        NullInputHandler( const NullInputHandler& ) = delete;
+        NullInputHandler& operator=( const NullInputHandler& ) = delete;
+        NullInputHandler( NullInputHandler&& ) = delete;
+        NullInputHandler& operator=( NullInputHandler&& ) = delete;
+
+        NullInputHandler();
+        ~NullInputHandler() override = default;
+
+        virtual bool Initialize(WindowHandler* windowHandler) override;
+        virtual void Update(const float deltaTime) override;
+        virtual bool IsKeyDown(Key key) const override;
+        virtual bool IsGamepadButtonDown(GamepadId gamepadId, GamepadButton button) const override;
+
+        void SetKey(Key key, bool bIsDown);
+        void SetMouseButton(MouseButton button, bool bIsDown);
+        void ScrollMouse(MouseScrollAxis axis, float value);
+
+        void SetGamepadConnected(GamepadId gamepadId, bool bIsConnected);
+        void SetGamepadButton(GamepadId gamepadId, GamepadButton button, bool bIsDown);
+        void SetGamepadAxis(GamepadId gamepadId, GamepadAxis axis, float value);
+
+    protected:
+        virtual void OnDeviceConnected(const int inputDeviceId, InputDevice device) override;
+        virtual void OnDeviceDisconnected(const int inputDeviceId, InputDevice device) override;
+        virtual void OnReplayInput(const unsigned int inputDeviceId, const InputEvent& inputEvent, bool bIsAxis) override;
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<QueuedInput> queuedInputs_;
+        std::vector<QueuedInput> processingInputs_;
+
+        std::array<bool, KEY_COUNT> keyStates_;
+        std::array<std::array<bool, GAMEPAD_BUTTON_COUNT>, GAMEPAD_COUNT> gamepadButtonStates_;
+        std::array<std::array<float, GAMEPAD_AXIS_COUNT>, GAMEPAD_COUNT> gamepadAxisStates_;
+        std::array<bool, GAMEPAD_COUNT> gamepadConnectedStates_;
+
+        void QueueInput(InputDevice device, const InputEvent& inputEvent, bool bIsAxis);
+    };
+}
+
+#endif // AUX_NULL_INPUTHANDLER_H
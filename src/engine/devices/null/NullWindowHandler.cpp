@@ -0,0 +1,50 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/devices/null/NullWindowHandler.h"
+#include "engine/DebugLog.h"
+
+#include <chrono>
+#include <thread>
+
+namespace  AuxEngine
+{
+    NullWindowHandler::NullWindowHandler() :
+        width_( 0 ),
+        height_( 0 ),
+        bIsOpen_( false )
+    {}
+
+    bool NullWindowHandler::InitializeWindow( const int width, const int height, const std::string& name )
+    {
+        width_ = width;
+        height_ = height;
+        bIsOpen_ = true;
+
+        DEBUG_LOG(LOG::INFO, "Running headless, no window created for {} ({}x{}).", name, width, height);
+        return true;
+    }
+
+    bool NullWindowHandler::IsWindowOpen() const
+    {
+        return bIsOpen_;
+    }
+
+    void NullWindowHandler::ProcessEvents() const
+    {
+        // No platform events without a window.
+    }
+
+    void NullWindowHandler::WaitEvents( const double timeoutSeconds ) const
+    {
+        // Nothing can wake us early, so this is a plain sleep.
+        if( timeoutSeconds > 0.0 )
+        {
+            std::this_thread::sleep_for( std::chrono::duration<double>( timeoutSeconds ) );
+        }
+    }
+
+    void NullWindowHandler::Shutdown() const
+    {
+        bIsOpen_ = false;
+    }
+}
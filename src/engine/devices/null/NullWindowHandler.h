@@ -0,0 +1,40 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_NULL_WINDOWHANDLER_H
+#define AUX_NULL_WINDOWHANDLER_H
+
+#include "engine/WindowHandler.h"
+
+namespace  AuxEngine
+{
+    /*
+    * Window handler for display-less hosts. No window is created, the window is considered open from initialization until shutdown.
+    */
+    class NullWindowHandler : public WindowHandler
+    {
+    public:
+        NullWindowHandler( const NullWindowHandler& ) = delete;
+        NullWindowHandler& operator=( const NullWindowHandler& ) = delete;
+        NullWindowHandler( NullWindowHandler&& ) = delete;
+        NullWindowHandler& operator=( NullWindowHandler&& ) = delete;
+
+        NullWindowHandler();
+        ~NullWindowHandler() override = default;
+
+        virtual bool InitializeWindow( const int width, const int height, const std::string& name ) override;
+        virtual bool IsWindowOpen() const override;
+        virtual void ProcessEvents() const override;
+        virtual void Shutdown() const override;
+        virtual void WaitEvents( const double timeoutSeconds ) const override;
+
+        int GetWidth() const { return width_; }
+        int GetHeight() const { return height_; }
+
+    private:
+        int width_;
+        int height_;
+        mutable bool bIsOpen_;
+    };
+}
+
+#endif // AUX_NULL_WINDOWHANDLER_H
@@ -0,0 +1,31 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_ENGINEEVENTS_H
+#define AUX_ENGINEEVENTS_H
+
+#include "engine/InputHandler.h"
+
+namespace AuxEngine
+{
+    // Events the engine posts to its EventBus. Subscribe through Engine::Get().GetEventBus().
+
+    struct WindowResizedEvent
+    {
+        int width = 0;
+        int height = 0;
+    };
+
+    struct WindowFocusChangedEvent
+    {
+        bool bIsFocused = false;
+    };
+
+    struct InputDeviceChangedEvent
+    {
+        int inputDeviceId = -1;
+        InputDevice device = InputDevice::Other;
+        bool bIsConnected = false;
+    };
+}
+
+#endif // !AUX_ENGINEEVENTS_H
@@ -0,0 +1,169 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/events/EventBus.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace AuxEngine
+{
+    EventBus::EventBus(size_t capacity)
+        : mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1)
+        , enqueuePosition_(0)
+        , dequeuePosition_(0)
+        , droppedCount_(0)
+        , nextSubscriptionId_(1)
+        , bHasRemovedSubscribers_(false)
+        , bIsDispatching_(false)
+    {
+        cells_ = std::make_unique<Cell[]>(mask_ + 1);
+        for (size_t i = 0; i <= mask_; ++i)
+        {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    void EventBus::Unsubscribe(SubscriptionId subscriptionId)
+    {
+        // Only flagged while dispatching, the callback may be the one running. It is destroyed once the dispatch finishes.
+        for (auto& [typeId, subscriber] : pendingSubscribers_)
+        {
+            if (subscriber.id == subscriptionId)
+            {
+                subscriber.bIsRemoved = true;
+                return;
+            }
+        }
+
+        for (std::vector<Subscriber>& subscribers : subscribers_)
+        {
+            for (auto it = subscribers.begin(); it != subscribers.end(); ++it)
+            {
+                if (it->id == subscriptionId)
+                {
+                    if (bIsDispatching_)
+                    {
+                        it->bIsRemoved = true;
+                        bHasRemovedSubscribers_ = true;
+                    }
+                    else
+                    {
+                        subscribers.erase(it);
+                    }
+                    return;
+                }
+            }
+        }
+    }
+
+    size_t EventBus::Dispatch()
+    {
+        const size_t endPosition = enqueuePosition_.load(std::memory_order_acquire);
+
+        size_t dispatchedCount = 0;
+        bIsDispatching_ = true;
+        while (dequeuePosition_ != endPosition)
+        {
+            Cell& cell = cells_[dequeuePosition_ & mask_];
+
+            // Claimed by a producer that has not finished writing yet, pick it up next time.
+            if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition_ + 1)
+            {
+                break;
+            }
+
+            const EventTypeId typeId = cell.record.typeId;
+            if (typeId < subscribers_.size())
+            {
+                for (const Subscriber& subscriber : subscribers_[typeId])
+                {
+                    if (!subscriber.bIsRemoved)
+                    {
+                        subscriber.callback(cell.record.payload);
+                    }
+                }
+            }
+
+            cell.sequence.store(dequeuePosition_ + mask_ + 1, std::memory_order_release);
+            ++dequeuePosition_;
+            ++dispatchedCount;
+        }
+        bIsDispatching_ = false;
+
+        for (auto& [typeId, subscriber] : pendingSubscribers_)
+        {
+            if (!subscriber.bIsRemoved)
+            {
+                AddSubscriber(typeId, std::move(subscriber));
+            }
+        }
+        pendingSubscribers_.clear();
+
+        if (bHasRemovedSubscribers_)
+        {
+            for (std::vector<Subscriber>& subscribers : subscribers_)
+            {
+                std::erase_if(subscribers, [](const Subscriber& subscriber) { return subscriber.bIsRemoved; });
+            }
+            bHasRemovedSubscribers_ = false;
+        }
+
+        return dispatchedCount;
+    }
+
+    bool EventBus::PostBytes(EventTypeId typeId, const void* payload, size_t size)
+    {
+        size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        while (true)
+        {
+            cell = &cells_[position & mask_];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0)
+            {
+                if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                droppedCount_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                position = enqueuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->record.typeId = typeId;
+        std::memcpy(cell->record.payload, payload, size);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    SubscriptionId EventBus::SubscribeBytes(EventTypeId typeId, std::function<void(const void*)> callback)
+    {
+        const SubscriptionId subscriptionId = nextSubscriptionId_++;
+        if (bIsDispatching_)
+        {
+            pendingSubscribers_.emplace_back(typeId, Subscriber(subscriptionId, std::move(callback)));
+        }
+        else
+        {
+            AddSubscriber(typeId, Subscriber(subscriptionId, std::move(callback)));
+        }
+        return subscriptionId;
+    }
+
+    void EventBus::AddSubscriber(EventTypeId typeId, Subscriber subscriber)
+    {
+        if (typeId >= subscribers_.size())
+        {
+            subscribers_.resize(typeId + 1);
+        }
+        subscribers_[typeId].push_back(std::move(subscriber));
+    }
+}
@@ -0,0 +1,122 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_EVENTBUS_H
+#define AUX_EVENTBUS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace AuxEngine
+{
+    using EventTypeId = uint32_t;
+    using SubscriptionId = uint32_t;
+
+    inline std::atomic<EventTypeId> nextEventTypeId{ 0 };
+
+    // Dense id per event type, handed out on first use.
+    template<typename T>
+    EventTypeId GetEventTypeId()
+    {
+        static const EventTypeId id = nextEventTypeId.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    /*
+    * Typed event bus. Any thread may post, events are copied inline into a bounded lock-free ring and dispatched in batches on the main thread.
+    * Events must be small trivially copyable structs, so nothing is boxed or allocated per event.
+    * Subscribing, unsubscribing and dispatching happen on the main thread only.
+    */
+    class EventBus
+    {
+    public:
+        static constexpr size_t MAX_EVENT_SIZE{ 48 };
+
+    private:
+        struct EventRecord
+        {
+            EventTypeId typeId = 0;
+            alignas(std::max_align_t) std::byte payload[MAX_EVENT_SIZE];
+        };
+
+        // Vyukov style cell, the sequence tells producers and the consumer whose turn it is.
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            EventRecord record;
+        };
+
+        struct Subscriber
+        {
+            SubscriptionId id = 0;
+            std::function<void(const void*)> callback;
+            bool bIsRemoved = false;    // Unsubscribed during a dispatch, destroyed once it finishes
+        };
+
+    public:
+        // Capacity is rounded up to a power of two.
+        explicit EventBus(size_t capacity = 4096);
+        EventBus(const EventBus&) = delete;
+        EventBus(EventBus&&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
+        EventBus& operator=(EventBus&&) = delete;
+        ~EventBus() = default;
+
+        // Returns false and drops the event if the ring is full.
+        template<typename T>
+        bool Post(const T& event)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Events are copied as raw bytes and must be trivially copyable.");
+            static_assert(sizeof(T) <= MAX_EVENT_SIZE, "Event is too large to store inline.");
+            static_assert(alignof(T) <= alignof(std::max_align_t), "Event alignment is too strict.");
+
+            return PostBytes(GetEventTypeId<T>(), &event, sizeof(T));
+        }
+
+        template<typename T>
+        SubscriptionId Subscribe(std::function<void(const T&)> callback)
+        {
+            return SubscribeBytes(GetEventTypeId<T>(), [callback = std::move(callback)](const void* payload)
+            {
+                // The payload bytes may not be suitably typed storage, so copy out rather than cast.
+                T event;
+                std::memcpy(&event, payload, sizeof(T));
+                callback(event);
+            });
+        }
+
+        void Unsubscribe(SubscriptionId subscriptionId);
+
+        // Dispatches the events posted before the call, events posted while dispatching wait for the next call. Returns the number dispatched.
+        size_t Dispatch();
+
+        uint64_t GetDroppedCount() const { return droppedCount_.load(std::memory_order_relaxed); }
+
+    private:
+        std::unique_ptr<Cell[]> cells_;
+        size_t mask_;
+
+        alignas(64) std::atomic<size_t> enqueuePosition_;
+        alignas(64) size_t dequeuePosition_;
+        std::atomic<uint64_t> droppedCount_;
+
+        std::vector<std::vector<Subscriber>> subscribers_;
+        // Subscriptions made from inside a callback, added once the dispatch finishes.
+        std::vector<std::pair<EventTypeId, Subscriber>> pendingSubscribers_;
+        SubscriptionId nextSubscriptionId_;
+        bool bHasRemovedSubscribers_;
+        bool bIsDispatching_;
+
+        bool PostBytes(EventTypeId typeId, const void* payload, size_t size);
+        SubscriptionId SubscribeBytes(EventTypeId typeId, std::function<void(const void*)> callback);
+        void AddSubscriber(EventTypeId typeId, Subscriber subscriber);
+    };
+}
+
+#endif // !AUX_EVENTBUS_H
@@ -0,0 +1,299 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/jobs/JobSystem.h"
+
+#include "engine/AllocationTracker.h"
+#include "engine/CpuRelax.h"
+#include "engine/Profiler.h"
+
+#include <algorithm>
+#include <format>
+
+namespace AuxEngine
+{
+    // Number of empty polls before an idle worker goes to sleep.
+    static constexpr int IdleSpinCount{ 64 };
+
+    static thread_local const JobSystem* tl_jobSystem = nullptr;
+    static thread_local int tl_workerIndex = -1;
+    static thread_local uint32_t tl_externalStealSeed = 0x9E3779B9u;
+
+    static uint32_t NextRandom(uint32_t& seed)
+    {
+        // xorshift32
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed;
+    }
+
+    JobSystem::JobSystem(int workerThreadCount, JobFunction onWorkerStart)
+        : onWorkerStart_(std::move(onWorkerStart))
+        , bIsRunning_(true)
+        , externalJobCount_(0)
+        , queuedJobCount_(0)
+        , sleepingWorkerCount_(0)
+    {
+        const unsigned int threadCount = workerThreadCount < 0
+            ? std::max(std::thread::hardware_concurrency(), 2u) - 1
+            : static_cast<unsigned int>(workerThreadCount);
+
+        workers_.reserve(threadCount + 1);
+        for (unsigned int i = 0; i <= threadCount; ++i)
+        {
+            workers_.push_back(std::make_unique<Worker>());
+            workers_.back()->stealSeed = (i + 1) * 2654435761u;
+        }
+
+        tl_jobSystem = this;
+        tl_workerIndex = 0;
+
+        for (unsigned int i = 1; i <= threadCount; ++i)
+        {
+            workers_[i]->thread = std::thread(&JobSystem::WorkerLoop, this, i);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        bIsRunning_.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+        }
+        wakeCondition_.notify_all();
+
+        for (auto& worker : workers_)
+        {
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
+        }
+
+        for (Job* job : externalJobs_)
+        {
+            delete job;
+        }
+
+        if (tl_jobSystem == this)
+        {
+            tl_jobSystem = nullptr;
+            tl_workerIndex = -1;
+        }
+    }
+
+    void JobSystem::Schedule(JobFunction function, JobCounter* counter)
+    {
+        if (counter)
+        {
+            counter->pending_.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        const int workerIndex = GetWorkerIndex();
+        Job* job = AllocateJob(workerIndex);
+        job->function = std::move(function);
+        job->counter = counter;
+
+        if (workerIndex < 0)
+        {
+            std::lock_guard<std::mutex> lock(externalMutex_);
+            externalJobs_.push_back(job);
+            externalJobCount_.fetch_add(1, std::memory_order_release);
+        }
+        else if (!workers_[workerIndex]->queue.Push(job))
+        {
+            // Our queue is full, running it now is better than dropping it.
+            Execute(job);
+            return;
+        }
+
+        queuedJobCount_.fetch_add(1, std::memory_order_seq_cst);
+        WakeWorker();
+    }
+
+    void JobSystem::Wait(const JobCounter& counter)
+    {
+        const int workerIndex = GetWorkerIndex();
+        while (!counter.IsComplete())
+        {
+            if (Job* job = FindJob(workerIndex))
+            {
+                Execute(job);
+            }
+            else
+            {
+                CpuRelax();
+            }
+        }
+    }
+
+    void JobSystem::ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& function)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        batchSize = std::max<size_t>(batchSize, 1);
+
+        JobCounter counter;
+        size_t begin = 0;
+        for (; begin + batchSize < count; begin += batchSize)
+        {
+            const size_t end = begin + batchSize;
+            Schedule([&function, begin, end]() { function(begin, end); }, &counter);
+        }
+
+        // The calling thread takes the last batch itself rather than waiting idle.
+        function(begin, count);
+        Wait(counter);
+    }
+
+    bool JobSystem::RunPendingJob()
+    {
+        Job* job = FindJob(GetWorkerIndex());
+        if (!job)
+        {
+            return false;
+        }
+        Execute(job);
+        return true;
+    }
+
+    void JobSystem::WorkerLoop(unsigned int workerIndex)
+    {
+        tl_jobSystem = this;
+        tl_workerIndex = static_cast<int>(workerIndex);
+        AUX_PROFILE_THREAD(std::format("Worker {}", workerIndex));
+        AUX_ALLOCATION_SCOPE(AllocationTag::Jobs);
+
+        if (onWorkerStart_)
+        {
+            onWorkerStart_();
+        }
+
+        int idleSpins = 0;
+        while (bIsRunning_.load(std::memory_order_acquire))
+        {
+            if (Job* job = FindJob(static_cast<int>(workerIndex)))
+            {
+                Execute(job);
+                idleSpins = 0;
+                continue;
+            }
+
+            if (++idleSpins < IdleSpinCount)
+            {
+                CpuRelax();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            sleepingWorkerCount_.fetch_add(1, std::memory_order_seq_cst);
+            wakeCondition_.wait(lock, [this]()
+                {
+                    return !bIsRunning_.load(std::memory_order_acquire) || queuedJobCount_.load(std::memory_order_seq_cst) > 0;
+                });
+            sleepingWorkerCount_.fetch_sub(1, std::memory_order_relaxed);
+            idleSpins = 0;
+        }
+    }
+
+    int JobSystem::GetWorkerIndex() const
+    {
+        return tl_jobSystem == this ? tl_workerIndex : -1;
+    }
+
+    JobSystem::Job* JobSystem::AllocateJob(int workerIndex)
+    {
+        if (workerIndex >= 0)
+        {
+            Worker& worker = *workers_[workerIndex];
+            Job* job = &worker.jobPool[worker.nextJob++ % JobPoolCapacity];
+            if (!job->bInFlight.load(std::memory_order_acquire))
+            {
+                job->bInFlight.store(true, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        // Either not one of our threads, or the pool wrapped onto a job that has not finished yet.
+        // Blocking here until it finishes could deadlock when that job is further up our own stack.
+        Job* job = new Job();
+        job->bHeapAllocated = true;
+        return job;
+    }
+
+    JobSystem::Job* JobSystem::FindJob(int workerIndex)
+    {
+        Job* job = nullptr;
+
+        if (workerIndex >= 0 && workers_[workerIndex]->queue.Pop(job))
+        {
+            queuedJobCount_.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+
+        if (externalJobCount_.load(std::memory_order_acquire) > 0)
+        {
+            std::lock_guard<std::mutex> lock(externalMutex_);
+            if (!externalJobs_.empty())
+            {
+                job = externalJobs_.back();
+                externalJobs_.pop_back();
+                externalJobCount_.fetch_sub(1, std::memory_order_relaxed);
+                queuedJobCount_.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        uint32_t& seed = workerIndex >= 0 ? workers_[workerIndex]->stealSeed : tl_externalStealSeed;
+        const size_t workerCount = workers_.size();
+        const size_t start = NextRandom(seed) % workerCount;
+        for (size_t i = 0; i < workerCount; ++i)
+        {
+            const size_t victim = (start + i) % workerCount;
+            if (static_cast<int>(victim) != workerIndex && workers_[victim]->queue.Steal(job))
+            {
+                queuedJobCount_.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JobSystem::Execute(Job* job)
+    {
+        job->function();
+        job->function = nullptr;
+
+        JobCounter* counter = job->counter;
+        if (job->bHeapAllocated)
+        {
+            delete job;
+        }
+        else
+        {
+            job->counter = nullptr;
+            job->bInFlight.store(false, std::memory_order_release);
+        }
+
+        if (counter)
+        {
+            counter->pending_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    void JobSystem::WakeWorker()
+    {
+        if (sleepingWorkerCount_.load(std::memory_order_seq_cst) > 0)
+        {
+            // Taking the lock orders the notify after a worker that is about to sleep has checked its predicate.
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex_);
+            }
+            wakeCondition_.notify_one();
+        }
+    }
+}
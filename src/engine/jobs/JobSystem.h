@@ -0,0 +1,120 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_JOBSYSTEM_H
+#define AUX_JOBSYSTEM_H
+
+#include "engine/jobs/WorkStealingQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AuxEngine
+{
+    using JobFunction = std::function<void()>;
+
+    /*
+    * Tracks completion of a group of jobs. Scheduling against a counter increments it, each finished job decrements it.
+    * The counter must outlive the jobs scheduled against it, waiting on it before it goes out of scope guarantees that.
+    */
+    class JobCounter
+    {
+        friend class JobSystem;
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter(JobCounter&&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+        JobCounter& operator=(JobCounter&&) = delete;
+        ~JobCounter() = default;
+
+        bool IsComplete() const { return pending_.load(std::memory_order_acquire) == 0; }
+        int GetPendingCount() const { return pending_.load(std::memory_order_acquire); }
+
+    private:
+        std::atomic<int> pending_{ 0 };
+    };
+
+    /*
+    * Work-stealing job system. The thread that creates it becomes worker 0 and only runs jobs while it waits.
+    * Every other worker owns a thread and a Chase-Lev deque, idle workers steal from the others before going to sleep.
+    */
+    class JobSystem
+    {
+        struct Job
+        {
+            JobFunction function;
+            JobCounter* counter = nullptr;
+            std::atomic<bool> bInFlight{ false };
+            bool bHeapAllocated = false;
+        };
+
+        static constexpr size_t QueueCapacity{ 4096 };
+        static constexpr size_t JobPoolCapacity{ 4096 };
+
+        struct Worker
+        {
+            WorkStealingQueue<Job*, QueueCapacity> queue;
+            std::unique_ptr<Job[]> jobPool = std::make_unique<Job[]>(JobPoolCapacity);
+            size_t nextJob = 0;
+            uint32_t stealSeed = 0;
+            std::thread thread;
+        };
+
+    public:
+        // A negative thread count creates one worker per hardware thread, minus the calling thread.
+        // A thread count of 0 creates none, jobs then only run on the calling thread while it waits or runs pending jobs.
+        // The optional function runs first thing on every worker thread, for thread local setup such as the current service registry.
+        explicit JobSystem(int workerThreadCount = -1, JobFunction onWorkerStart = nullptr);
+        JobSystem(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem& operator=(JobSystem&&) = delete;
+        ~JobSystem();
+
+        // Queues the function to run on any worker. When given a counter, it is incremented now and decremented once the job is done.
+        void Schedule(JobFunction function, JobCounter* counter = nullptr);
+
+        // Runs other jobs on the calling thread until every job scheduled against the counter has finished.
+        void Wait(const JobCounter& counter);
+
+        // Splits [0, count) into batches of batchSize and runs function(begin, end) for each batch across the workers, returns once all are done.
+        void ParallelFor(size_t count, size_t batchSize, const std::function<void(size_t begin, size_t end)>& function);
+
+        // Runs a single pending job on the calling thread, returns false if there was nothing to run.
+        bool RunPendingJob();
+
+        // Includes the thread that created the job system.
+        unsigned int GetWorkerCount() const { return static_cast<unsigned int>(workers_.size()); }
+
+    private:
+        std::vector<std::unique_ptr<Worker>> workers_;
+        JobFunction onWorkerStart_;
+        std::atomic<bool> bIsRunning_;
+
+        // Jobs scheduled from threads that are not workers of this job system.
+        std::mutex externalMutex_;
+        std::vector<Job*> externalJobs_;
+        std::atomic<int> externalJobCount_;
+
+        std::mutex wakeMutex_;
+        std::condition_variable wakeCondition_;
+        std::atomic<int> queuedJobCount_;
+        std::atomic<int> sleepingWorkerCount_;
+
+        void WorkerLoop(unsigned int workerIndex);
+        int GetWorkerIndex() const;
+
+        Job* AllocateJob(int workerIndex);
+        Job* FindJob(int workerIndex);
+        void Execute(Job* job);
+        void WakeWorker();
+    };
+}
+
+#endif // !AUX_JOBSYSTEM_H
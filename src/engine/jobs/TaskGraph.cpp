@@ -0,0 +1,239 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#include "engine/jobs/TaskGraph.h"
+
+#include "engine/CpuRelax.h"
+#include "engine/DebugLog.h"
+#include "engine/jobs/JobSystem.h"
+
+#include <algorithm>
+
+namespace AuxEngine
+{
+    static bool Intersects(const std::vector<TaskResourceId>& first, const std::vector<TaskResourceId>& second)
+    {
+        for (const TaskResourceId resource : first)
+        {
+            if (std::find(second.begin(), second.end(), resource) != second.end())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TaskGraph::AddTask(const std::string& name, TaskFunction function,
+        const std::vector<TaskResourceId>& reads, const std::vector<TaskResourceId>& writes,
+        TaskAffinity affinity)
+    {
+        if (bIsExecuting_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(pendingChangesMutex_);
+            pendingChanges_.push_back(PendingChange{ Task{ name, std::move(function), reads, writes, affinity }, false });
+            return true;
+        }
+
+        if (HasTask(name))
+        {
+            DEBUG_LOG(LOG::WARNING, "Task {} already exists in the task graph.", name);
+            return false;
+        }
+
+        tasks_.push_back(Task{ name, std::move(function), reads, writes, affinity });
+        bIsCompiled_ = false;
+        return true;
+    }
+
+    bool TaskGraph::RemoveTask(const std::string& name)
+    {
+        if (bIsExecuting_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(pendingChangesMutex_);
+            pendingChanges_.push_back(PendingChange{ Task{ .name = name }, true });
+            return true;
+        }
+
+        const auto it = std::find_if(tasks_.begin(), tasks_.end(), [&name](const Task& task) { return task.name == name; });
+        if (it == tasks_.end())
+        {
+            return false;
+        }
+
+        tasks_.erase(it);
+        bIsCompiled_ = false;
+        return true;
+    }
+
+    bool TaskGraph::HasTask(const std::string& name) const
+    {
+        return std::any_of(tasks_.begin(), tasks_.end(), [&name](const Task& task) { return task.name == name; });
+    }
+
+    bool TaskGraph::Compile()
+    {
+        const size_t taskCount = tasks_.size();
+
+        for (const Task& task : tasks_)
+        {
+            if (!task.function)
+            {
+                DEBUG_LOG(LOG::ERRORLOG, "Failed to compile task graph. Task {} has no function!", task.name);
+                return false;
+            }
+        }
+
+        // Edges only ever point from earlier to later tasks, so the graph cannot contain a cycle.
+        std::vector<std::vector<size_t>> successors(taskCount);
+        predecessorCounts_.assign(taskCount, 0);
+
+        for (size_t later = 0; later < taskCount; ++later)
+        {
+            for (size_t earlier = 0; earlier < later; ++earlier)
+            {
+                if (Conflicts(tasks_[earlier], tasks_[later]))
+                {
+                    successors[earlier].push_back(later);
+                    ++predecessorCounts_[later];
+                }
+            }
+        }
+
+        successorOffsets_.assign(taskCount + 1, 0);
+        successors_.clear();
+        roots_.clear();
+
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            successorOffsets_[i] = successors_.size();
+            successors_.insert(successors_.end(), successors[i].begin(), successors[i].end());
+
+            if (predecessorCounts_[i] == 0)
+            {
+                roots_.push_back(i);
+            }
+        }
+        successorOffsets_[taskCount] = successors_.size();
+
+        pendingPredecessors_ = std::make_unique<std::atomic<int>[]>(taskCount);
+        mainThreadReady_.reserve(taskCount);
+
+        bIsCompiled_ = true;
+        return true;
+    }
+
+    void TaskGraph::Execute(JobSystem* jobSystem)
+    {
+        if (!bIsCompiled_ && !Compile())
+        {
+            return;
+        }
+
+        bIsExecuting_.store(true, std::memory_order_release);
+
+        if (!jobSystem)
+        {
+            for (Task& task : tasks_)
+            {
+                task.function();
+            }
+            FinishExecute();
+            return;
+        }
+
+        jobSystem_ = jobSystem;
+        for (size_t i = 0; i < tasks_.size(); ++i)
+        {
+            pendingPredecessors_[i].store(predecessorCounts_[i], std::memory_order_relaxed);
+        }
+        remainingTasks_.store(tasks_.size(), std::memory_order_release);
+
+        for (const size_t root : roots_)
+        {
+            Dispatch(root);
+        }
+
+        while (remainingTasks_.load(std::memory_order_acquire) > 0)
+        {
+            size_t mainThreadTask = tasks_.size();
+            {
+                std::lock_guard<std::mutex> lock(mainThreadMutex_);
+                if (!mainThreadReady_.empty())
+                {
+                    mainThreadTask = mainThreadReady_.back();
+                    mainThreadReady_.pop_back();
+                }
+            }
+
+            if (mainThreadTask < tasks_.size())
+            {
+                RunTask(mainThreadTask);
+            }
+            else if (!jobSystem_->RunPendingJob())
+            {
+                CpuRelax();
+            }
+        }
+
+        jobSystem_ = nullptr;
+        FinishExecute();
+    }
+
+    void TaskGraph::FinishExecute()
+    {
+        bIsExecuting_.store(false, std::memory_order_release);
+
+        std::vector<PendingChange> pendingChanges;
+        {
+            std::lock_guard<std::mutex> lock(pendingChangesMutex_);
+            pendingChanges.swap(pendingChanges_);
+        }
+
+        for (PendingChange& change : pendingChanges)
+        {
+            if (change.bIsRemoval)
+            {
+                RemoveTask(change.task.name);
+            }
+            else
+            {
+                AddTask(change.task.name, std::move(change.task.function), change.task.reads, change.task.writes, change.task.affinity);
+            }
+        }
+    }
+
+    bool TaskGraph::Conflicts(const Task& first, const Task& second)
+    {
+        return Intersects(first.writes, second.reads)
+            || Intersects(first.writes, second.writes)
+            || Intersects(first.reads, second.writes);
+    }
+
+    void TaskGraph::Dispatch(size_t taskIndex)
+    {
+        if (tasks_[taskIndex].affinity == TaskAffinity::MainThread)
+        {
+            std::lock_guard<std::mutex> lock(mainThreadMutex_);
+            mainThreadReady_.push_back(taskIndex);
+        }
+        else
+        {
+            jobSystem_->Schedule([this, taskIndex]() { RunTask(taskIndex); });
+        }
+    }
+
+    void TaskGraph::RunTask(size_t taskIndex)
+    {
+        tasks_[taskIndex].function();
+
+        for (size_t i = successorOffsets_[taskIndex]; i < successorOffsets_[taskIndex + 1]; ++i)
+        {
+            const size_t successor = successors_[i];
+            if (pendingPredecessors_[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                Dispatch(successor);
+            }
+        }
+
+        remainingTasks_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
@@ -0,0 +1,106 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_TASKGRAPH_H
+#define AUX_TASKGRAPH_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace AuxEngine
+{
+    class JobSystem;
+
+    // Identifies data shared between tasks, e.g. COMPILE_TIME_HASH("Input").
+    using TaskResourceId = unsigned int;
+
+    enum class TaskAffinity
+    {
+        Any = 0,        // May run on any worker
+        MainThread      // Always runs on the thread calling Execute, e.g. for window or GLFW calls
+    };
+
+    /*
+    * Directed acyclic graph of tasks executed once per frame.
+    * Each task declares the resources it reads and writes. A task depends on every task added before it that
+    * writes something it reads or writes, or reads something it writes. Independent branches run concurrently.
+    * The graph is compiled on first execute and recompiled only after tasks are added or removed.
+    */
+    class TaskGraph
+    {
+    public:
+        using TaskFunction = std::function<void()>;
+
+        TaskGraph() = default;
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph(TaskGraph&&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+        TaskGraph& operator=(TaskGraph&&) = delete;
+        ~TaskGraph() = default;
+
+        // Returns false if a task with the same name already exists.
+        // Called while Execute runs, e.g. from a task, the change is queued and applied once Execute finishes,
+        // the result then only says it was queued and a rejected change is logged when it is applied.
+        bool AddTask(const std::string& name, TaskFunction function,
+            const std::vector<TaskResourceId>& reads, const std::vector<TaskResourceId>& writes,
+            TaskAffinity affinity = TaskAffinity::Any);
+        bool RemoveTask(const std::string& name);
+        bool HasTask(const std::string& name) const;
+
+        // Builds the dependency edges. Called by Execute when the graph changed, returns false if the graph is invalid.
+        bool Compile();
+        bool IsCompiled() const { return bIsCompiled_; }
+
+        // Runs every task once and returns when all have finished. Without a job system, tasks run serially in the order they were added.
+        void Execute(JobSystem* jobSystem);
+
+        size_t GetTaskCount() const { return tasks_.size(); }
+
+    private:
+        struct Task
+        {
+            std::string name = {};
+            TaskFunction function = {};
+            std::vector<TaskResourceId> reads = {};
+            std::vector<TaskResourceId> writes = {};
+            TaskAffinity affinity = TaskAffinity::Any;
+        };
+
+        struct PendingChange
+        {
+            Task task;
+            bool bIsRemoval = false;
+        };
+
+        std::vector<Task> tasks_;
+        bool bIsCompiled_ = false;
+
+        // Changes made while Execute runs, tasks_ must not move under the workers.
+        std::atomic<bool> bIsExecuting_{ false };
+        std::mutex pendingChangesMutex_;
+        std::vector<PendingChange> pendingChanges_;
+
+        // Compiled graph, successors of task i are successors_[successorOffsets_[i], successorOffsets_[i + 1]).
+        std::vector<size_t> successorOffsets_;
+        std::vector<size_t> successors_;
+        std::vector<int> predecessorCounts_;
+        std::vector<size_t> roots_;
+
+        // Per execution state.
+        std::unique_ptr<std::atomic<int>[]> pendingPredecessors_;
+        std::atomic<size_t> remainingTasks_{ 0 };
+        JobSystem* jobSystem_ = nullptr;
+        std::mutex mainThreadMutex_;
+        std::vector<size_t> mainThreadReady_;
+
+        static bool Conflicts(const Task& first, const Task& second);
+        void FinishExecute();
+        void Dispatch(size_t taskIndex);
+        void RunTask(size_t taskIndex);
+    };
+}
+
+#endif // !AUX_TASKGRAPH_H
@@ -0,0 +1,109 @@
+// MIT License, Copyright (c) 2025 Malik Allen
+
+#ifndef AUX_WORKSTEALINGQUEUE_H
+#define AUX_WORKSTEALINGQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace AuxEngine
+{
+    /*
+    * Fixed capacity Chase-Lev work-stealing deque.
+    * The owning thread pushes and pops at the bottom (LIFO), any other thread may steal from the top (FIFO).
+    * Memory orderings follow "Correct and Efficient Work-Stealing for Weak Memory Models" (Le, Pop, Cohen, Nardelli 2013),
+    * except Push publishes with a release store on bottom instead of a release fence.
+    * Capacity must be a power of two.
+    */
+    template<typename T, size_t Capacity>
+    class WorkStealingQueue
+    {
+        static_assert((Capacity & (Capacity - 1)) == 0, "WorkStealingQueue capacity must be a power of two.");
+        static constexpr int64_t Mask = static_cast<int64_t>(Capacity) - 1;
+
+    public:
+        WorkStealingQueue() = default;
+        WorkStealingQueue(const WorkStealingQueue&) = delete;
+        WorkStealingQueue(WorkStealingQueue&&) = delete;
+        WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+        WorkStealingQueue& operator=(WorkStealingQueue&&) = delete;
+        ~WorkStealingQueue() = default;
+
+        // Owner thread only. Returns false when the queue is full.
+        bool Push(T item)
+        {
+            const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+            const int64_t top = top_.load(std::memory_order_acquire);
+            if (bottom - top >= static_cast<int64_t>(Capacity))
+            {
+                return false;
+            }
+
+            buffer_[bottom & Mask].store(item, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Owner thread only.
+        bool Pop(T& outItem)
+        {
+            const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+            bottom_.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = top_.load(std::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // Queue was already empty.
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            outItem = buffer_[bottom & Mask].load(std::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // Last item, race any thieves for it.
+                const bool bWon = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+                return bWon;
+            }
+            return true;
+        }
+
+        // Any thread.
+        bool Steal(T& outItem)
+        {
+            int64_t top = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+            if (top >= bottom)
+            {
+                return false;
+            }
+
+            T item = buffer_[top & Mask].load(std::memory_order_relaxed);
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            outItem = item;
+            return true;
+        }
+
+        bool IsEmpty() const
+        {
+            return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        // Owner and thieves hammer different ends, keep them on separate cache lines.
+        alignas(64) std::atomic<int64_t> top_{ 0 };
+        alignas(64) std::atomic<int64_t> bottom_{ 0 };
+        alignas(64) std::array<std::atomic<T>, Capacity> buffer_{};
+    };
+}
+
+#endif // !AUX_WORKSTEALINGQUEUE_H
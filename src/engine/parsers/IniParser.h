@@ -3,6 +3,9 @@
 #ifndef AUX_INIPARSER_H
 #define AUX_INIPARSER_H
 
+#include "engine/AllocationTracker.h"
+#include "engine/Profiler.h"
+
 #include "mini/ini.h"
 
 typedef mINI::INIFile Ini;
@@ -54,6 +57,7 @@ namespace AuxEngine
 
         std::string GetString(const std::string& section, const std::string& key, const std::string& defaultValue = "")
         {
+            AUX_ALLOCATION_SCOPE(AllocationTag::Parsers);
             if (!data_[section][key].empty())
             {
                 return data_[section][key];
@@ -66,6 +70,7 @@ namespace AuxEngine
 
         int GetInteger(const std::string& section, const std::string& key, int defaultValue = 0)
         {
+            AUX_ALLOCATION_SCOPE(AllocationTag::Parsers);
             if (!data_[section][key].empty())
             {
                 return std::stoi(data_[section][key]);
@@ -78,6 +83,7 @@ namespace AuxEngine
 
         float GetFloat(const std::string& section, const std::string& key, float defaultValue = 0.0f)
         {
+            AUX_ALLOCATION_SCOPE(AllocationTag::Parsers);
             if (!data_[section][key].empty())
             {
                 return std::stof(data_[section][key]);
@@ -89,6 +95,7 @@ namespace AuxEngine
         }
         float GetDouble(const std::string& section, const std::string& key, float defaultValue = 0.0)
         {
+            AUX_ALLOCATION_SCOPE(AllocationTag::Parsers);
             if (!data_[section][key].empty())
             {
                 return std::stod(data_[section][key]);
@@ -101,6 +108,7 @@ namespace AuxEngine
 
         bool GetBoolean(const std::string& section, const std::string& key, bool defaultValue = false)
         {
+            AUX_ALLOCATION_SCOPE(AllocationTag::Parsers);
             std::string value = data_[section][key];
             if (value.empty())
             {
@@ -152,11 +160,15 @@ namespace AuxEngine
 
         bool Read()
         {
+            AUX_PROFILE_SCOPE("IniParser::Read");
+            AUX_ALLOCATION_SCOPE(AllocationTag::Parsers);
             return file_.read(data_);
         }
 
         bool Write()
         {
+            AUX_PROFILE_SCOPE("IniParser::Write");
+            AUX_ALLOCATION_SCOPE(AllocationTag::Parsers);
             return file_.write(data_);
         }
 
@@ -3,6 +3,9 @@
 #ifndef AUX_JSONPARSER_H
 #define AUX_JSONPARSER_H
 
+#include "engine/AllocationTracker.h"
+#include "engine/Profiler.h"
+
 #include "nlohmann/json.hpp"
 
 #include <fstream>
@@ -29,6 +32,8 @@ namespace AuxEngine
 
         bool ParseFromString( const std::string& jsonString )
         {
+            AUX_PROFILE_SCOPE( "JsonParser::ParseFromString" );
+            AUX_ALLOCATION_SCOPE( AllocationTag::Parsers );
             try
             {
                 jsonData_ = json::parse( jsonString );
@@ -44,6 +49,8 @@ namespace AuxEngine
         // Load JSON from a file
         bool ParseFromFile( const std::string& fileName )
         {
+            AUX_PROFILE_SCOPE( "JsonParser::ParseFromFile" );
+            AUX_ALLOCATION_SCOPE( AllocationTag::Parsers );
             std::ifstream file( fileName );
             if( !file.is_open() )
             {